@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc
+#include <string.h> // strdup, strcmp
+#include <math.h> // pow
+#include <time.h> // clock
+
+// replays a Zipfian query trace against a word tree
+// the same source is linked with bst.o (BST) or splay.o (splay tree), both with tree.o, or avlt.o (AVL tree, -DUSE_AVLT)
+
+#ifdef USE_AVLT
+#include "avlt.h"
+#define TREE_NAME		"avlt"
+#define BST_Create		AVLT_Create
+#define BST_Destroy		AVLT_Destroy
+#define BST_Insert		AVLT_Insert
+#define BST_Search		AVLT_Search
+#define BST_Traverse	AVLT_Traverse
+#define BST_Count		AVLT_Count
+#else
+#include "bst.h"
+#ifdef USE_SPLAY
+#define TREE_NAME		"splay"
+#else
+#define TREE_NAME		"bst"
+#endif
+#endif
+
+#define NUM_QUERIES		1000000
+#define ZIPF_S			1.0 // skewness of the query distribution
+
+// User structure type definition
+// 단어 구조체
+typedef struct {
+	char	*word;		// 단어
+	int		freq;		// 빈도
+} tWord;
+
+static long num_compares = 0;
+
+// 모든 단어 (hot word 순서로 섞임)
+static tWord **words;
+static int num_words = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+tWord *createWord( char *word)
+{
+	tWord *newWord = malloc( sizeof( tWord));
+
+	if (newWord == NULL) return NULL;
+
+	newWord->word = strdup( word);
+	newWord->freq = 1;
+
+	return newWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void destroyWord( void *pWord)
+{
+	free( ((tWord *)pWord)->word);
+	free( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// compares two words in word structures (counts the number of calls)
+int compare_by_word( const void *n1, const void *n2)
+{
+	num_compares++;
+	return strcmp( ((tWord *)n1)->word, ((tWord *)n2)->word);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void increase_freq(void *dataPtr)
+{
+	((tWord *)dataPtr)->freq++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// collects words in tree
+// for BST_Traverse function
+void collect_word(const void *dataPtr)
+{
+	words[num_words++] = (tWord *)dataPtr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// xorshift random number generator (same sequence on every platform)
+static unsigned int seed = 2463534242u;
+
+static unsigned int next_rand(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// makes query trace: trace[i] is the rank of the queried word (0 = hottest)
+// P(rank k) ~ 1 / (k+1)^s
+void make_zipf_trace( int *trace, int num_queries, int n, double s)
+{
+	double *cdf = malloc( sizeof( double) * n);
+	double sum = 0.0;
+
+	for (int k = 0; k < n; k++)
+	{
+		sum += 1.0 / pow( k + 1, s);
+		cdf[k] = sum;
+	}
+
+	for (int i = 0; i < num_queries; i++)
+	{
+		double u = (next_rand() / 4294967296.0) * sum;
+		int lo = 0, hi = n - 1;
+
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (cdf[mid] < u) lo = mid + 1;
+			else hi = mid;
+		}
+		trace[i] = lo;
+	}
+	free( cdf);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	TREE *tree;
+	char word[100];
+	tWord *pWord;
+	int *trace;
+	int found = 0;
+	int ret;
+	FILE *fp;
+	clock_t start;
+	double build_time, query_time;
+	long build_compares;
+
+	if (argc != 2) {
+		fprintf( stderr, "usage: %s FILE\n", argv[0]);
+		return 1;
+	}
+
+	fp = fopen( argv[1], "rt");
+	if (!fp)
+	{
+		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
+		return 2;
+	}
+
+	tree = BST_Create(compare_by_word);
+	if (!tree)
+	{
+		printf( "Cannot create a tree\n");
+		return 100;
+	}
+
+	start = clock();
+	while(fscanf( fp, "%99s", word) != EOF)
+	{
+		pWord = createWord( word);
+
+		ret = BST_Insert( tree, pWord, increase_freq);
+
+		if (ret == 0 || ret == 2) // failure or duplicated
+		{
+			destroyWord( pWord);
+		}
+	}
+	build_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+	build_compares = num_compares;
+	fclose( fp);
+
+	words = malloc( sizeof( tWord *) * BST_Count(tree));
+	BST_Traverse( tree, collect_word);
+
+	// hot words are chosen at random (not in alphabetical order)
+	for (int i = num_words - 1; i > 0; i--)
+	{
+		int j = next_rand() % (i + 1);
+		tWord *temp = words[i];
+		words[i] = words[j];
+		words[j] = temp;
+	}
+
+	trace = malloc( sizeof( int) * NUM_QUERIES);
+	make_zipf_trace( trace, NUM_QUERIES, num_words, ZIPF_S);
+
+	num_compares = 0;
+	start = clock();
+	for (int i = 0; i < NUM_QUERIES; i++)
+	{
+		if (BST_Search( tree, words[trace[i]]) != NULL) found++;
+	}
+	query_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf( "%-6s %d words, build %.3fs (%ld compares), %d queries %.3fs (%.1f ns/query, %.1f compares/query), %d found\n",
+		TREE_NAME, num_words, build_time, build_compares,
+		NUM_QUERIES, query_time, query_time * 1e9 / NUM_QUERIES, (double)num_compares / NUM_QUERIES, found);
+
+	free( trace);
+	free( words);
+	BST_Destroy( tree, destroyWord);
+
+	return 0;
+}
@@ -3,6 +3,9 @@
 
 #include "bst.h"
 
+// unbalanced BST implementation of bst.h
+// (creation, destruction, sorted build and traversals are shared with splay.c in tree.c)
+
 // internal functions (not mandatory)
 // used in BST_Insert
 static int _insert( NODE *root, NODE *newPtr, int (*compare)(const void *, const void *), void (*callback)(void *))
@@ -30,31 +33,6 @@ static int _insert( NODE *root, NODE *newPtr, int (*compare)(const void *, const
     }
 }
 
-// used in BST_Insert
-static NODE *_makeNode( void *dataInPtr)
-{
-    NODE *newnode = (NODE*)malloc(sizeof(NODE));
-    if (newnode == NULL) return NULL;
-
-    newnode->dataPtr = dataInPtr;
-    newnode->left = NULL;
-    newnode->right = NULL;
-
-    return newnode;
-}
-
-// used in BST_Destroy
-static void _destroy( NODE *root, void (*callback)(void *))
-{
-    if(!root) return;
-
-    _destroy(root->left, callback);
-    _destroy(root->right, callback);
-
-    callback(root->dataPtr);
-    free(root);
-}
-
 // used in BST_Delete
 // return 	pointer to root
 static NODE *_delete( NODE *root, void *keyPtr, void **dataOutPtr, int (*compare)(const void *, const void *))
@@ -121,65 +99,13 @@ static NODE *_search( NODE *root, void *keyPtr, int (*compare)(const void *, con
         return root;
 }
 
-// used in BST_Traverse
-static void _traverse( NODE *root, void (*callback)(const void *))
-{
-    if(!root) return;
-
-    _traverse(root->left, callback);
-    callback(root->dataPtr);
-    _traverse(root->right, callback);
-}
-
-// used in BST_TraverseR
-static void _traverseR( NODE *root, void (*callback)(const void *))
-{
-    if(!root) return;
-
-    _traverseR(root->right, callback);
-    callback(root->dataPtr);
-    _traverseR(root->left, callback);
-}
-
-// used in printTree
-static void _inorder_print( NODE *root, int level, void (*callback)(const void *))
-{
-    if(!root) return;
-    
-    _inorder_print(root->right, level + 1, callback);
-
-    for(int i = 0; i < level; i++)
-        printf("\t");
-    callback(root->dataPtr);
-
-    _inorder_print(root->left, level + 1, callback);
-}
-
 
 ////////////////////////////////////////////////////////////////////////////////
 // bst.h function declarations
 
-TREE *BST_Create( int (*compare)(const void *, const void *))
-{
-    TREE *newtree = (TREE*)malloc(sizeof(TREE));
-    if (newtree == NULL) return NULL;
-
-    newtree->compare = compare;
-    newtree->count = 0;
-    newtree->root = NULL;
-
-    return newtree;
-}
-
-void BST_Destroy( TREE *pTree, void (*callback)(void *))
-{
-    _destroy(pTree->root, callback);
-    free(pTree);
-}
-
 int BST_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *))
 {
-    NODE *newnode = _makeNode(dataInPtr);
+    NODE *newnode = TREE_MakeNode(dataInPtr);
     if (!newnode) return 0;
 
     if(pTree->root == NULL){
@@ -217,23 +143,3 @@ void *BST_Search( TREE *pTree, void *keyPtr)
 
     return targetnode->dataPtr;
 }
-
-void BST_Traverse( TREE *pTree, void (*callback)(const void *))
-{
-    _traverse(pTree->root, callback);
-}
-
-void BST_TraverseR( TREE *pTree, void (*callback)(const void *))
-{
-    _traverseR(pTree->root, callback);
-}
-
-void printTree( TREE *pTree, void (*callback)(const void *))
-{
-    _inorder_print(pTree->root, 0, callback);
-}
-
-int BST_Count( TREE *pTree)
-{
-    return pTree->count;
-}
\ No newline at end of file
@@ -35,6 +35,17 @@ void BST_Destroy( TREE *pTree, void (*callback)(void *));
 */
 int BST_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *));
 
+/* Builds a perfectly balanced tree from data sorted in ascending order (O(n))
+	the tree must be empty; dataArr is owned by caller (not kept by the tree)
+	merge가 NULL이 아니면 인접한 중복 키를 하나로 합침 (첫 번째 데이터가 트리에 남음)
+	merge(kept, dup)는 dup의 내용을 kept에 반영하고 dup을 해제해야 함
+	dataArr의 내용은 바뀌지 않음 (단, 합쳐진 dup은 해제되었으므로 성공 후에는 사용하지 말 것)
+	실패하면 merge는 호출되지 않으며 트리와 데이터 모두 그대로임
+	return	0 overflow (or tree not empty)
+			1 success
+*/
+int BST_BuildFromSorted( TREE *pTree, void **dataArr, int n, void (*merge)(void *, void *));
+
 /* Deletes a node with keyPtr from the tree
 	return	address of data of the node containing the key
 			NULL not found
@@ -63,3 +74,12 @@ void printTree( TREE *pTree, void (*callback)(const void *));
 */
 int BST_Count( TREE *pTree);
 
+////////////////////////////////////////////////////////////////////////////////
+// shared by the implementations of bst.h (tree.c)
+
+/* Allocates a node for dataInPtr without subtrees
+	return	node pointer
+			NULL if overflow
+*/
+NODE *TREE_MakeNode( void *dataInPtr);
+
@@ -0,0 +1,149 @@
+#include <stdlib.h> // malloc
+#include <stdio.h>
+
+#include "bst.h"
+
+// splay tree implementation of bst.h
+// every access moves the node containing the key (or the last node on the search path) to the root,
+// so frequently accessed (hot) keys stay close to the root
+// (creation, destruction, sorted build and traversals are shared with bst.c in tree.c)
+
+// internal functions (not mandatory)
+// top-down splay
+// moves the node containing the key to the root
+// if not found, the last node on the search path becomes the root
+// return 	pointer to (new) root
+static NODE *_splay( NODE *root, void *keyPtr, int (*compare)(const void *, const void *))
+{
+    if (root == NULL) return NULL;
+
+    NODE header;
+    NODE *leftMax = &header; // rightmost node of the left tree
+    NODE *rightMin = &header; // leftmost node of the right tree
+
+    header.left = NULL;
+    header.right = NULL;
+
+    while (1) {
+        int cmp = compare(keyPtr, root->dataPtr);
+
+        if (cmp < 0) {
+            if (root->left == NULL) break;
+
+            if (compare(keyPtr, root->left->dataPtr) < 0) {
+                // zig-zig: rotate right
+                NODE *temp = root->left;
+                root->left = temp->right;
+                temp->right = root;
+                root = temp;
+                if (root->left == NULL) break;
+            }
+            // link right
+            rightMin->left = root;
+            rightMin = root;
+            root = root->left;
+        }
+        else if (cmp > 0) {
+            if (root->right == NULL) break;
+
+            if (compare(keyPtr, root->right->dataPtr) > 0) {
+                // zig-zig: rotate left
+                NODE *temp = root->right;
+                root->right = temp->left;
+                temp->left = root;
+                root = temp;
+                if (root->right == NULL) break;
+            }
+            // link left
+            leftMax->right = root;
+            leftMax = root;
+            root = root->right;
+        }
+        else break;
+    }
+
+    // assemble
+    leftMax->right = root->left;
+    rightMin->left = root->right;
+    root->left = header.right;
+    root->right = header.left;
+
+    return root;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// bst.h function declarations
+
+int BST_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *))
+{
+    if (pTree->root != NULL) {
+        pTree->root = _splay(pTree->root, dataInPtr, pTree->compare);
+
+        int cmp = pTree->compare(dataInPtr, pTree->root->dataPtr);
+        if (cmp == 0) {
+            callback(pTree->root->dataPtr);
+            return 2;
+        }
+
+        NODE *newnode = TREE_MakeNode(dataInPtr);
+        if (!newnode) return 0;
+
+        // split the tree at the new node
+        if (cmp < 0) {
+            newnode->left = pTree->root->left;
+            newnode->right = pTree->root;
+            pTree->root->left = NULL;
+        }
+        else {
+            newnode->right = pTree->root->right;
+            newnode->left = pTree->root;
+            pTree->root->right = NULL;
+        }
+        pTree->root = newnode;
+    }
+    else {
+        NODE *newnode = TREE_MakeNode(dataInPtr);
+        if (!newnode) return 0;
+
+        pTree->root = newnode;
+    }
+
+    pTree->count++;
+    return 1;
+}
+
+void *BST_Delete( TREE *pTree, void *keyPtr)
+{
+    if (pTree->root == NULL) return NULL;
+
+    pTree->root = _splay(pTree->root, keyPtr, pTree->compare);
+    if (pTree->compare(keyPtr, pTree->root->dataPtr) != 0) return NULL;
+
+    NODE *target = pTree->root;
+    void *gom = target->dataPtr;
+
+    if (target->left == NULL) {
+        pTree->root = target->right;
+    }
+    else {
+        // every key in the left subtree is smaller than keyPtr,
+        // so splaying it brings its maximum to the root (with no right child)
+        pTree->root = _splay(target->left, keyPtr, pTree->compare);
+        pTree->root->right = target->right;
+    }
+    free(target);
+    pTree->count--;
+
+    return gom;
+}
+
+void *BST_Search( TREE *pTree, void *keyPtr)
+{
+    if (pTree->root == NULL) return NULL;
+
+    pTree->root = _splay(pTree->root, keyPtr, pTree->compare);
+    if (pTree->compare(keyPtr, pTree->root->dataPtr) != 0) return NULL;
+
+    return pTree->root->dataPtr;
+}
@@ -0,0 +1,249 @@
+#include <stdlib.h> // malloc
+#include <stdio.h>
+
+#include "bst.h"
+
+// common part of the implementations of bst.h (bst.c, splay.c):
+// the functions that do not depend on how the tree is searched and rebalanced.
+// destruction and traversals are iterative (constant space), because a BST fed with sorted input
+// or a splay tree after sequential access is a path as long as the tree
+
+// internal functions (not mandatory)
+
+// used in _build
+// frees nodes only (data is not touched)
+static void _freeNodes( NODE *root)
+{
+    if(!root) return;
+
+    _freeNodes(root->left);
+    _freeNodes(root->right);
+    free(root);
+}
+
+// used in BST_BuildFromSorted
+// builds subtree from dataArr[lo..hi] with the middle element as root (depth is log n)
+// return	pointer to root
+//			NULL if overflow (partially built nodes are freed)
+static NODE *_build( void **dataArr, int lo, int hi, int *overflow)
+{
+    if (lo > hi) return NULL;
+
+    int mid = lo + (hi - lo) / 2;
+    NODE *root = TREE_MakeNode(dataArr[mid]);
+    if (root == NULL) {
+        *overflow = 1;
+        return NULL;
+    }
+
+    root->left = _build(dataArr, lo, mid - 1, overflow);
+    root->right = _build(dataArr, mid + 1, hi, overflow);
+
+    if (*overflow) {
+        _freeNodes(root);
+        return NULL;
+    }
+    return root;
+}
+
+// used in BST_Destroy
+// a left child is rotated up until the root has none, then the root is freed
+static void _destroy( NODE *root, void (*callback)(void *))
+{
+    while (root) {
+        if (root->left) {
+            NODE *temp = root->left;
+            root->left = temp->right;
+            temp->right = root;
+            root = temp;
+        }
+        else {
+            NODE *next = root->right;
+            callback(root->dataPtr);
+            free(root);
+            root = next;
+        }
+    }
+}
+
+// used in BST_Traverse
+// Morris traversal: the rightmost node of each left subtree temporarily points back to its successor
+// (the links are restored before returning)
+static void _traverse( NODE *root, void (*callback)(const void *))
+{
+    while (root) {
+        if (root->left == NULL) {
+            callback(root->dataPtr);
+            root = root->right;
+            continue;
+        }
+
+        NODE *pre = root->left;
+        while (pre->right != NULL && pre->right != root)
+            pre = pre->right;
+
+        if (pre->right == NULL) {
+            pre->right = root; // thread to the successor
+            root = root->left;
+        }
+        else {
+            pre->right = NULL; // left subtree done
+            callback(root->dataPtr);
+            root = root->right;
+        }
+    }
+}
+
+// used in BST_TraverseR
+// mirror image of _traverse
+static void _traverseR( NODE *root, void (*callback)(const void *))
+{
+    while (root) {
+        if (root->right == NULL) {
+            callback(root->dataPtr);
+            root = root->left;
+            continue;
+        }
+
+        NODE *pre = root->right;
+        while (pre->left != NULL && pre->left != root)
+            pre = pre->left;
+
+        if (pre->left == NULL) {
+            pre->left = root;
+            root = root->right;
+        }
+        else {
+            pre->left = NULL;
+            callback(root->dataPtr);
+            root = root->left;
+        }
+    }
+}
+
+// used in printTree
+// _traverseR keeping the level of root: a thread back to a node is followed by a walk
+// over the k left links from its right child to the threaded node, which is k + 1 levels below it
+static void _inorder_print( NODE *root, int level, void (*callback)(const void *))
+{
+    while (root) {
+        if (root->right != NULL) {
+            NODE *pre = root->right;
+            int k = 0;
+            while (pre->left != NULL && pre->left != root) {
+                pre = pre->left;
+                k++;
+            }
+
+            if (pre->left == NULL) {
+                pre->left = root;
+                root = root->right;
+                level++;
+                continue;
+            }
+            pre->left = NULL;
+            level -= k + 2; // arrived by the thread from pre, one level below pre
+        }
+
+        for(int i = 0; i < level; i++)
+            printf("\t");
+        callback(root->dataPtr);
+
+        root = root->left;
+        level++;
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// bst.h function declarations
+
+NODE *TREE_MakeNode( void *dataInPtr)
+{
+    NODE *newnode = (NODE*)malloc(sizeof(NODE));
+    if (newnode == NULL) return NULL;
+
+    newnode->dataPtr = dataInPtr;
+    newnode->left = NULL;
+    newnode->right = NULL;
+
+    return newnode;
+}
+
+TREE *BST_Create( int (*compare)(const void *, const void *))
+{
+    TREE *newtree = (TREE*)malloc(sizeof(TREE));
+    if (newtree == NULL) return NULL;
+
+    newtree->compare = compare;
+    newtree->count = 0;
+    newtree->root = NULL;
+
+    return newtree;
+}
+
+void BST_Destroy( TREE *pTree, void (*callback)(void *))
+{
+    _destroy(pTree->root, callback);
+    free(pTree);
+}
+
+int BST_BuildFromSorted( TREE *pTree, void **dataArr, int n, void (*merge)(void *, void *))
+{
+    void **unique = dataArr; // data of the nodes (the first of equal keys)
+    int num = n;
+
+    if (pTree->root != NULL) return 0;
+
+    // duplicates are skipped in a separate buffer, so nothing is changed if the build fails
+    if (merge != NULL && n > 0) {
+        unique = (void **)malloc(sizeof(void *) * n);
+        if (unique == NULL) return 0;
+
+        num = 0;
+        unique[num++] = dataArr[0];
+        for (int i = 1; i < n; i++)
+            if (pTree->compare(unique[num - 1], dataArr[i]) != 0)
+                unique[num++] = dataArr[i];
+    }
+
+    int overflow = 0;
+    NODE *root = _build(unique, 0, num - 1, &overflow);
+    if (unique != dataArr) free(unique);
+    if (overflow) return 0;
+
+    // merges duplicates into the data kept in the tree
+    if (merge != NULL) {
+        int last = 0;
+        for (int i = 1; i < n; i++) {
+            if (pTree->compare(dataArr[last], dataArr[i]) == 0)
+                merge(dataArr[last], dataArr[i]);
+            else
+                last = i;
+        }
+    }
+
+    pTree->root = root;
+    pTree->count = num;
+    return 1;
+}
+
+void BST_Traverse( TREE *pTree, void (*callback)(const void *))
+{
+    _traverse(pTree->root, callback);
+}
+
+void BST_TraverseR( TREE *pTree, void (*callback)(const void *))
+{
+    _traverseR(pTree->root, callback);
+}
+
+void printTree( TREE *pTree, void (*callback)(const void *))
+{
+    _inorder_print(pTree->root, 0, callback);
+}
+
+int BST_Count( TREE *pTree)
+{
+    return pTree->count;
+}
@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h> // aligned_alloc, free
+#include <string.h> // memcpy
+
+#include "adt_heap.h"
+
+// d-ary heap implementation of adt_heap.h
+// children of i are HEAP_D * i + 1 ... HEAP_D * i + HEAP_D
+// heapArr is shifted by HEAP_D - 1 elements from a cache-line-aligned block,
+// so that every sibling group starts at a multiple of HEAP_D pointers (HEAP_D = 8: one group per cache line)
+
+#ifndef HEAP_D
+#define HEAP_D		4
+#endif
+
+#define CACHE_LINE	64
+
+#define FIRST_CHILD(i)	(HEAP_D * (i) + 1)
+#define PARENT(i)		(((i) - 1) / HEAP_D)
+
+/* Allocates aligned heap array for capacity elements
+   return address of heapArr (not the allocated block)
+          NULL if overflow
+*/
+static void **_allocArr( int capacity)
+{
+    size_t size = sizeof(void *) * (capacity + HEAP_D - 1);
+    size = (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE; // multiple of alignment
+
+    void **base = (void **)aligned_alloc(CACHE_LINE, size);
+    if (base == NULL) return NULL;
+
+    return base + (HEAP_D - 1);
+}
+
+/* Frees heap array allocated by _allocArr
+*/
+static void _freeArr( void **heapArr)
+{
+    free(heapArr - (HEAP_D - 1));
+}
+
+/* Reestablishes heap by moving data in child up to correct location heap array
+   for heap_Insert function
+*/
+static void _reheapUp( HEAP *heap, int index)
+{
+    void *data = heap->heapArr[index];
+
+    while (index > 0) {
+        int parent = PARENT(index);
+        if (heap->compare(data, heap->heapArr[parent]) <= 0) break;
+
+        heap->heapArr[index] = heap->heapArr[parent]; // move parent down into the hole
+        index = parent;
+    }
+    heap->heapArr[index] = data;
+}
+
+/* Reestablishes heap by moving data down to its correct location in the heap
+   for heap_Build function
+*/
+static void _reheapDown( HEAP *heap, int index)
+{
+    void *data = heap->heapArr[index];
+    int child;
+
+    while ((child = FIRST_CHILD(index)) < heap->last) {
+        // largest child in the sibling group
+        int end = child + HEAP_D;
+        if (end > heap->last) end = heap->last;
+
+        int largest = child;
+        for (child++; child < end; child++) {
+            if (heap->compare(heap->heapArr[child], heap->heapArr[largest]) > 0) largest = child;
+        }
+        if (heap->compare(heap->heapArr[largest], data) <= 0) break;
+
+        heap->heapArr[index] = heap->heapArr[largest]; // move child up into the hole
+        index = largest;
+    }
+    heap->heapArr[index] = data;
+}
+
+/* Places data into the hole at the root (Floyd's "bounce")
+   for heap_Delete function
+   the hole descends to a leaf along the largest children without comparing against data, then data sifts up
+*/
+static void _reheapBounce( HEAP *heap, void *data)
+{
+    int index = 0;
+    int child;
+
+    while ((child = FIRST_CHILD(index)) < heap->last) {
+        // largest child in the sibling group
+        int end = child + HEAP_D;
+        if (end > heap->last) end = heap->last;
+
+        int largest = child;
+        for (child++; child < end; child++) {
+            if (heap->compare(heap->heapArr[child], heap->heapArr[largest]) > 0) largest = child;
+        }
+
+        heap->heapArr[index] = heap->heapArr[largest]; // move child up into the hole
+        index = largest;
+    }
+    heap->heapArr[index] = data;
+
+    _reheapUp(heap, index);
+}
+
+
+HEAP *heap_Create( int (*compare) (const void *arg1, const void *arg2))
+{
+    HEAP *newheap = (HEAP*)malloc(sizeof(HEAP));
+    if (newheap == NULL) return NULL;
+
+    newheap->capacity = 10;
+    newheap->compare = compare;
+    newheap->last = 0;
+    newheap->heapArr = _allocArr(newheap->capacity);
+
+    if (newheap->heapArr == NULL) {
+        free(newheap);
+        return NULL;
+    }
+
+    return newheap;
+}
+
+void heap_Destroy( HEAP *heap, void (*remove_data)(void *ptr))
+{
+    for (int i = 0; i < heap->last; i++) {
+        if (heap->heapArr[i] != NULL) {
+            remove_data(heap->heapArr[i]);
+        }
+    }
+    _freeArr(heap->heapArr);
+    free(heap);
+}
+
+int heap_Reserve( HEAP *heap, int capacity)
+{
+    if (capacity <= heap->capacity) return 1;
+
+    // aligned memory cannot be realloc'ed
+    void **newHeapArr = _allocArr(capacity);
+    if (newHeapArr == NULL) return 0; // Memory allocation failed
+
+    memcpy(newHeapArr, heap->heapArr, sizeof(void *) * heap->last);
+    _freeArr(heap->heapArr);
+
+    heap->heapArr = newHeapArr;
+    heap->capacity = capacity;
+
+    return 1;
+}
+
+int heap_Build( HEAP *heap, void **array, int n)
+{
+    if (!heap_Reserve(heap, heap->last + n)) return 0;
+
+    for (int i = 0; i < n; i++) {
+        heap->heapArr[heap->last++] = array[i];
+    }
+
+    // reheap down every internal node from the last one to the root
+    if (heap->last > 1) {
+        for (int i = PARENT(heap->last - 1); i >= 0; i--) {
+            _reheapDown(heap, i);
+        }
+    }
+
+    return 1;
+}
+
+int heap_Insert( HEAP *heap, void *dataPtr)
+{
+    if (heap->last >= heap->capacity) {
+        if (!heap_Reserve(heap, heap->capacity * 2)) return 0;
+    }
+
+    heap->heapArr[heap->last] = dataPtr;
+    _reheapUp(heap, heap->last);
+    heap->last++;
+
+    return 1; // Successful insertion
+}
+
+int heap_Delete( HEAP *heap, void **dataOutPtr)
+{
+    if (heap->last == 0) {
+        *dataOutPtr = NULL; // Explicitly set to NULL
+        return 0; // Heap is empty
+    }
+
+    void *data = heap->heapArr[heap->last - 1];
+
+    *dataOutPtr = heap->heapArr[0];
+    heap->heapArr[heap->last - 1] = *dataOutPtr;
+    heap->last--;
+
+    _reheapBounce(heap, data);
+
+    return 1; // Successful deletion
+}
+
+int heap_Empty(  HEAP *heap)
+{
+    if (heap->last == 0) return 1;
+    else return 0;
+}
+
+void heap_Print( HEAP *heap, void (*print_func) (const void *data))
+{
+    for (int i = 0; i < heap->last; i++) {
+        print_func(heap->heapArr[i]);
+    }
+    printf("\n");
+}
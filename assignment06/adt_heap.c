@@ -5,45 +5,65 @@
 
 /* Reestablishes heap by moving data in child up to correct location heap array
    for heap_Insert function
+   parents are moved down into the hole and the data is written once at the end
 */
 static void _reheapUp( HEAP *heap, int index)
 {
-    if (index == 0) return; // Root node, no need to reheap up
+    void *data = heap->heapArr[index];
 
-    int parent = (index - 1) / 2;
-    if (heap->compare(heap->heapArr[index], heap->heapArr[parent]) > 0) {
-        // Swap parent and child
-        void *temp = heap->heapArr[parent];
-        heap->heapArr[parent] = heap->heapArr[index];
-        heap->heapArr[index] = temp;
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (heap->compare(data, heap->heapArr[parent]) <= 0) break;
 
-        _reheapUp(heap, parent); // Recursive call for parent
+        heap->heapArr[index] = heap->heapArr[parent]; // move parent down into the hole
+        index = parent;
     }
+    heap->heapArr[index] = data;
 }
 
 /* Reestablishes heap by moving data in root down to its correct location in the heap
-   for heap_Delete function
+   for heap_Build and heap_PartialSort functions
+   larger children are moved up into the hole and the data is written once at the end
 */
 static void _reheapDown( HEAP *heap, int index)
 {
-    int leftChild = 2 * index + 1;
-    int rightChild = 2 * index + 2;
-    int largest = index;
-
-    if (leftChild < heap->last && heap->compare(heap->heapArr[leftChild], heap->heapArr[largest]) > 0) {
-        largest = leftChild;
-    }
-    if (rightChild < heap->last && heap->compare(heap->heapArr[rightChild], heap->heapArr[largest]) > 0) {
-        largest = rightChild;
+    void *data = heap->heapArr[index];
+    int child;
+
+    while ((child = 2 * index + 1) < heap->last) {
+        // larger child
+        if (child + 1 < heap->last && heap->compare(heap->heapArr[child + 1], heap->heapArr[child]) > 0) {
+            child++;
+        }
+        if (heap->compare(heap->heapArr[child], data) <= 0) break;
+
+        heap->heapArr[index] = heap->heapArr[child]; // move child up into the hole
+        index = child;
     }
-    if (largest != index) {
-        // Swap current node with the largest child
-        void *temp = heap->heapArr[index];
-        heap->heapArr[index] = heap->heapArr[largest];
-        heap->heapArr[largest] = temp;
+    heap->heapArr[index] = data;
+}
 
-        _reheapDown(heap, largest); // Recursive call for the child
+/* Places data into the hole at the root (Floyd's "bounce")
+   for heap_Delete function
+   the hole descends to a leaf along the larger children without comparing against data
+   (data comes from the bottom of the heap and usually belongs there), then data sifts up
+*/
+static void _reheapBounce( HEAP *heap, void *data)
+{
+    int index = 0;
+    int child;
+
+    while ((child = 2 * index + 1) < heap->last) {
+        // larger child
+        if (child + 1 < heap->last && heap->compare(heap->heapArr[child + 1], heap->heapArr[child]) > 0) {
+            child++;
+        }
+        heap->heapArr[index] = heap->heapArr[child]; // move child up into the hole
+        index = child;
     }
+    heap->heapArr[index] = data;
+
+    _reheapUp(heap, index);
 }
 
 
@@ -93,6 +113,35 @@ int heap_Insert( HEAP *heap, void *dataPtr)
     return 1; // Successful insertion
 }
 
+int heap_Reserve( HEAP *heap, int capacity)
+{
+    if (capacity <= heap->capacity) return 1;
+
+    void **newHeapArr = realloc(heap->heapArr, sizeof(void*) * capacity);
+    if (newHeapArr == NULL) return 0; // Memory allocation failed
+
+    heap->heapArr = newHeapArr;
+    heap->capacity = capacity;
+
+    return 1;
+}
+
+int heap_Build( HEAP *heap, void **array, int n)
+{
+    if (!heap_Reserve(heap, heap->last + n)) return 0;
+
+    for (int i = 0; i < n; i++) {
+        heap->heapArr[heap->last++] = array[i];
+    }
+
+    // reheap down every internal node from the last one to the root
+    for (int i = heap->last / 2 - 1; i >= 0; i--) {
+        _reheapDown(heap, i);
+    }
+
+    return 1;
+}
+
 int heap_Delete( HEAP *heap, void **dataOutPtr)
 {
    if (heap->last == 0) {
@@ -100,16 +149,47 @@ int heap_Delete( HEAP *heap, void **dataOutPtr)
       return 0; // Heap is empty
    }
 
+   void *data = heap->heapArr[heap->last - 1];
+
    *dataOutPtr = heap->heapArr[0];
-   heap->heapArr[0] = heap->heapArr[heap->last - 1];
    heap->heapArr[heap->last - 1] = *dataOutPtr;
    heap->last--;
 
-   _reheapDown(heap, 0);
+   _reheapBounce(heap, data);
 
    return 1; // Successful deletion
 }
 
+void heap_Sort( void **array, int n, int (*compare) (const void *arg1, const void *arg2))
+{
+    heap_PartialSort(array, n, n, compare);
+}
+
+void heap_PartialSort( void **array, int n, int k, int (*compare) (const void *arg1, const void *arg2))
+{
+    // heap over the caller's array (nothing allocated)
+    HEAP heap = { n, n, array, compare };
+    void *dataPtr;
+
+    if (k > n) k = n;
+
+    for (int i = heap.last / 2 - 1; i >= 0; i--) {
+        _reheapDown(&heap, i);
+    }
+
+    // heap_Delete moves the deleted data to heapArr[last], so the k highest end up in array[n-k..n-1] (lowest first)
+    for (int i = 0; i < k; i++) {
+        heap_Delete(&heap, &dataPtr);
+    }
+
+    // reverse the array: array[0..k-1] becomes the k highest, highest first
+    for (int i = 0, j = n - 1; i < j; i++, j--) {
+        dataPtr = array[i];
+        array[i] = array[j];
+        array[j] = dataPtr;
+    }
+}
+
 int heap_Empty(  HEAP *heap)
 {
 	if (heap->last == 0) return 1;
@@ -21,11 +21,32 @@ return 1 if successful; 0 if heap full
 */
 int heap_Insert( HEAP *heap, void *dataPtr);
 
+/* Makes sure heapArr can hold capacity elements without reallocation
+return 1 if successful; 0 if overflow
+*/
+int heap_Reserve( HEAP *heap, int capacity);
+
+/* Adds n data pointers in array to heap at once and rebuilds heap bottom-up (Floyd's method, O(last + n))
+the array itself is not kept by heap
+return 1 if successful; 0 if overflow
+*/
+int heap_Build( HEAP *heap, void **array, int n);
+
 /* Deletes root of heap and passes data back to caller
 return 1 if successful; 0 if heap empty
 */
 int heap_Delete( HEAP *heap, void **dataOutPtr);
 
+/* Sorts n data pointers in array in place, in the order heap_Delete would return them (highest priority first)
+no memory is allocated; O(n log n)
+*/
+void heap_Sort( void **array, int n, int (*compare) (const void *arg1, const void *arg2));
+
+/* Moves the k data with highest priority to array[0..k-1] in heap_Delete order; the rest of array is left unordered
+no memory is allocated; O(n + k log n)
+*/
+void heap_PartialSort( void **array, int n, int k, int (*compare) (const void *arg1, const void *arg2));
+
 /*
 return 1 if heap empty; 0 if not
 */
@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free
+
+#include "adt_iheap.h"
+
+/* Places handle h at heapArr[index] and records its position
+*/
+static void _place( IHEAP *heap, int index, int h)
+{
+    heap->heapArr[index] = h;
+    heap->pos[h] = index;
+}
+
+/* Reestablishes heap by moving the handle at index up to correct location
+   for iheap_Insert and iheap_IncreaseKey functions
+*/
+static void _reheapUp( IHEAP *heap, int index)
+{
+    int h = heap->heapArr[index];
+    void *data = heap->dataArr[h];
+
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (heap->compare(data, heap->dataArr[heap->heapArr[parent]]) <= 0) break;
+
+        _place(heap, index, heap->heapArr[parent]); // move parent down into the hole
+        index = parent;
+    }
+    _place(heap, index, h);
+}
+
+/* Reestablishes heap by moving the handle at index down to its correct location
+   for iheap_Delete, iheap_DecreaseKey and iheap_Remove functions
+*/
+static void _reheapDown( IHEAP *heap, int index)
+{
+    int h = heap->heapArr[index];
+    void *data = heap->dataArr[h];
+    int child;
+
+    while ((child = 2 * index + 1) < heap->last) {
+        // larger child
+        if (child + 1 < heap->last &&
+            heap->compare(heap->dataArr[heap->heapArr[child + 1]], heap->dataArr[heap->heapArr[child]]) > 0) {
+            child++;
+        }
+        if (heap->compare(heap->dataArr[heap->heapArr[child]], data) <= 0) break;
+
+        _place(heap, index, heap->heapArr[child]); // move child up into the hole
+        index = child;
+    }
+    _place(heap, index, h);
+}
+
+/* Removes the handle at index from heap and makes the handle reusable
+   return data of the handle
+*/
+static void *_removeAt( IHEAP *heap, int index)
+{
+    int h = heap->heapArr[index];
+    void *data = heap->dataArr[h];
+
+    heap->last--;
+    if (index < heap->last) {
+        // fills the hole with the last handle, which may need to go either way
+        int moved = heap->heapArr[heap->last];
+        _place(heap, index, moved);
+        _reheapDown(heap, index);
+        if (heap->pos[moved] == index) _reheapUp(heap, index);
+    }
+
+    heap->pos[h] = -1;
+    heap->dataArr[h] = NULL;
+    heap->freeHandles[heap->numFree++] = h;
+
+    return data;
+}
+
+/* return 1 if handle is in heap; 0 if not
+*/
+static int _valid( IHEAP *heap, int handle)
+{
+    return handle >= 0 && handle < heap->numHandles && heap->pos[handle] >= 0;
+}
+
+/* Doubles the capacity of all arrays
+   return 1 if successful; 0 if overflow
+*/
+static int _grow( IHEAP *heap)
+{
+    int capacity = heap->capacity * 2;
+
+    int *heapArr = realloc(heap->heapArr, sizeof(int) * capacity);
+    if (heapArr == NULL) return 0;
+    heap->heapArr = heapArr;
+
+    void **dataArr = realloc(heap->dataArr, sizeof(void *) * capacity);
+    if (dataArr == NULL) return 0;
+    heap->dataArr = dataArr;
+
+    int *pos = realloc(heap->pos, sizeof(int) * capacity);
+    if (pos == NULL) return 0;
+    heap->pos = pos;
+
+    int *freeHandles = realloc(heap->freeHandles, sizeof(int) * capacity);
+    if (freeHandles == NULL) return 0;
+    heap->freeHandles = freeHandles;
+
+    heap->capacity = capacity;
+    return 1;
+}
+
+
+IHEAP *iheap_Create( int (*compare) (const void *arg1, const void *arg2))
+{
+    IHEAP *newheap = (IHEAP*)malloc(sizeof(IHEAP));
+    if (newheap == NULL) return NULL;
+
+    newheap->capacity = 10;
+    newheap->compare = compare;
+    newheap->last = 0;
+    newheap->numFree = 0;
+    newheap->numHandles = 0;
+    newheap->heapArr = (int *)malloc(sizeof(int) * newheap->capacity);
+    newheap->dataArr = (void **)malloc(sizeof(void *) * newheap->capacity);
+    newheap->pos = (int *)malloc(sizeof(int) * newheap->capacity);
+    newheap->freeHandles = (int *)malloc(sizeof(int) * newheap->capacity);
+
+    if (newheap->heapArr == NULL || newheap->dataArr == NULL || newheap->pos == NULL || newheap->freeHandles == NULL) {
+        free(newheap->heapArr);
+        free(newheap->dataArr);
+        free(newheap->pos);
+        free(newheap->freeHandles);
+        free(newheap);
+        return NULL;
+    }
+
+    return newheap;
+}
+
+void iheap_Destroy( IHEAP *heap, void (*remove_data)(void *ptr))
+{
+    for (int i = 0; i < heap->last; i++) {
+        remove_data(heap->dataArr[heap->heapArr[i]]);
+    }
+    free(heap->heapArr);
+    free(heap->dataArr);
+    free(heap->pos);
+    free(heap->freeHandles);
+    free(heap);
+}
+
+int iheap_Insert( IHEAP *heap, void *dataPtr)
+{
+    int h;
+
+    if (heap->numFree > 0) {
+        h = heap->freeHandles[--heap->numFree];
+    }
+    else {
+        if (heap->numHandles >= heap->capacity && !_grow(heap)) return -1;
+        h = heap->numHandles++;
+    }
+
+    heap->dataArr[h] = dataPtr;
+    _place(heap, heap->last, h);
+    _reheapUp(heap, heap->last);
+    heap->last++;
+
+    return h;
+}
+
+int iheap_Delete( IHEAP *heap, void **dataOutPtr)
+{
+    if (heap->last == 0) {
+        *dataOutPtr = NULL;
+        return 0; // Heap is empty
+    }
+
+    *dataOutPtr = _removeAt(heap, 0);
+
+    return 1;
+}
+
+int iheap_IncreaseKey( IHEAP *heap, int handle, void *dataPtr)
+{
+    if (!_valid(heap, handle)) return 0;
+
+    heap->dataArr[handle] = dataPtr;
+    _reheapUp(heap, heap->pos[handle]);
+
+    return 1;
+}
+
+int iheap_DecreaseKey( IHEAP *heap, int handle, void *dataPtr)
+{
+    if (!_valid(heap, handle)) return 0;
+
+    heap->dataArr[handle] = dataPtr;
+    _reheapDown(heap, heap->pos[handle]);
+
+    return 1;
+}
+
+int iheap_Remove( IHEAP *heap, int handle, void **dataOutPtr)
+{
+    if (!_valid(heap, handle)) {
+        *dataOutPtr = NULL;
+        return 0;
+    }
+
+    *dataOutPtr = _removeAt(heap, heap->pos[handle]);
+
+    return 1;
+}
+
+void *iheap_Get( IHEAP *heap, int handle)
+{
+    if (!_valid(heap, handle)) return NULL;
+
+    return heap->dataArr[handle];
+}
+
+int iheap_Empty( IHEAP *heap)
+{
+    if (heap->last == 0) return 1;
+    else return 0;
+}
+
+int iheap_Count( IHEAP *heap)
+{
+    return heap->last;
+}
@@ -0,0 +1,66 @@
+// indexed heap
+// every element gets a stable handle on insertion;
+// the position of each handle in heapArr is kept in pos[], so an element can be found, updated or removed in O(log n)
+
+typedef struct
+{
+	int	last;
+	int	capacity;
+	int	*heapArr; // handles in heap order
+	void **dataArr; // data of each handle
+	int	*pos; // index of each handle in heapArr (-1 if the handle is not used)
+	int	*freeHandles; // handles which can be reused
+	int	numFree;
+	int	numHandles; // # of handles ever used (0 ~ numHandles-1)
+	int (*compare) (const void *, const void *);
+} IHEAP;
+
+/* Allocates memory for heap and returns address of heap head structure
+if memory overflow, NULL returned
+*/
+IHEAP *iheap_Create( int (*compare) (const void *arg1, const void *arg2));
+
+/* Free memory for heap
+*/
+void iheap_Destroy( IHEAP *heap, void (*remove_data)(void *ptr));
+
+/* Inserts data into heap
+return handle of the data (0, 1, 2, ...) if successful; -1 if overflow
+*/
+int iheap_Insert( IHEAP *heap, void *dataPtr);
+
+/* Deletes root of heap and passes data back to caller
+the handle of the root becomes invalid (it may be reused)
+return 1 if successful; 0 if heap empty
+*/
+int iheap_Delete( IHEAP *heap, void **dataOutPtr);
+
+/* Replaces data of handle with dataPtr whose priority is higher than or equal to the old one
+(dataPtr may be the same data modified by caller)
+return 1 if successful; 0 if invalid handle
+*/
+int iheap_IncreaseKey( IHEAP *heap, int handle, void *dataPtr);
+
+/* Replaces data of handle with dataPtr whose priority is lower than or equal to the old one
+(dataPtr may be the same data modified by caller)
+return 1 if successful; 0 if invalid handle
+*/
+int iheap_DecreaseKey( IHEAP *heap, int handle, void *dataPtr);
+
+/* Removes data of handle from heap and passes it back to caller
+return 1 if successful; 0 if invalid handle
+*/
+int iheap_Remove( IHEAP *heap, int handle, void **dataOutPtr);
+
+/* returns data of handle; NULL if invalid handle
+*/
+void *iheap_Get( IHEAP *heap, int handle);
+
+/*
+return 1 if heap empty; 0 if not
+*/
+int iheap_Empty( IHEAP *heap);
+
+/* returns number of data in heap
+*/
+int iheap_Count( IHEAP *heap);
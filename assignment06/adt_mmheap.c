@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free
+
+#include "adt_mmheap.h"
+
+// dir: 1 on max levels, -1 on min levels
+// data at i is "better" than data at j if it is larger on a max level (smaller on a min level)
+#define BETTER(heap, i, j, dir)	((dir) * (heap)->compare((heap)->heapArr[i], (heap)->heapArr[j]) > 0)
+
+/* return 1 if index is on a max level (0, 3~6, 15~30, ...); -1 if on a min level
+*/
+static int _levelDir( int index)
+{
+    int level = 0;
+
+    for (index++; index > 1; index >>= 1) level++;
+
+    return (level % 2 == 0) ? 1 : -1;
+}
+
+static void _swap( MMHEAP *heap, int i, int j)
+{
+    void *temp = heap->heapArr[i];
+    heap->heapArr[i] = heap->heapArr[j];
+    heap->heapArr[j] = temp;
+}
+
+/* Moves data at index up through its grandparents on levels of the same kind
+   used in _pushUp
+*/
+static void _pushUpLevel( MMHEAP *heap, int index, int dir)
+{
+    while (index > 2) {
+        int grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!BETTER(heap, index, grandparent, dir)) break;
+
+        _swap(heap, index, grandparent);
+        index = grandparent;
+    }
+}
+
+/* Reestablishes heap by moving data at index (a new leaf) up
+   for mmheap_Insert function
+*/
+static void _pushUp( MMHEAP *heap, int index)
+{
+    int dir = _levelDir(index);
+
+    if (index == 0) return;
+
+    int parent = (index - 1) / 2;
+
+    // data belongs to the other kind of levels (e.g. smaller than its parent on a min level)
+    if (BETTER(heap, parent, index, dir)) {
+        _swap(heap, index, parent);
+        _pushUpLevel(heap, parent, -dir);
+    }
+    else _pushUpLevel(heap, index, dir);
+}
+
+/* Reestablishes heap by moving data at index down
+   the best of the children and grandchildren is compared with the data
+   for mmheap_DeleteMax and mmheap_DeleteMin functions
+*/
+static void _pushDown( MMHEAP *heap, int index)
+{
+    int dir = _levelDir(index);
+
+    while (2 * index + 1 < heap->last) {
+        int best = 2 * index + 1;
+
+        // children and grandchildren: 2i+1, 2i+2, 4i+3 ~ 4i+6
+        int candidates[5] = { 2 * index + 2, 4 * index + 3, 4 * index + 4, 4 * index + 5, 4 * index + 6 };
+        for (int k = 0; k < 5 && candidates[k] < heap->last; k++) {
+            if (BETTER(heap, candidates[k], best, dir)) best = candidates[k];
+        }
+
+        if (!BETTER(heap, best, index, dir)) break;
+
+        _swap(heap, index, best);
+        if (best <= 2 * index + 2) break; // child: it is a leaf of the other kind of level
+
+        // grandchild: the data moved down may have to change places with its parent
+        int parent = (best - 1) / 2;
+        if (BETTER(heap, parent, best, dir)) _swap(heap, best, parent);
+
+        index = best;
+    }
+}
+
+/* return index of the data with the lowest priority (last > 0)
+   used in mmheap_FindMin and mmheap_DeleteMin
+*/
+static int _minIndex( MMHEAP *heap)
+{
+    if (heap->last == 1) return 0;
+    if (heap->last == 2) return 1;
+
+    return (heap->compare(heap->heapArr[2], heap->heapArr[1]) < 0) ? 2 : 1;
+}
+
+/* Deletes data at index (root or min index) by moving the last data into it
+   used in mmheap_DeleteMax and mmheap_DeleteMin
+*/
+static void _deleteAt( MMHEAP *heap, int index, void **dataOutPtr)
+{
+    *dataOutPtr = heap->heapArr[index];
+    heap->last--;
+
+    if (index < heap->last) {
+        heap->heapArr[index] = heap->heapArr[heap->last];
+        _pushDown(heap, index);
+    }
+}
+
+
+MMHEAP *mmheap_Create( int (*compare) (const void *arg1, const void *arg2))
+{
+    MMHEAP *newheap = (MMHEAP*)malloc(sizeof(MMHEAP));
+    if (newheap == NULL) return NULL;
+
+    newheap->capacity = 10;
+    newheap->compare = compare;
+    newheap->last = 0;
+    newheap->heapArr = (void **)malloc(sizeof(void *) * newheap->capacity);
+
+    if (newheap->heapArr == NULL) {
+        free(newheap);
+        return NULL;
+    }
+
+    return newheap;
+}
+
+void mmheap_Destroy( MMHEAP *heap, void (*remove_data)(void *ptr))
+{
+    for (int i = 0; i < heap->last; i++) {
+        remove_data(heap->heapArr[i]);
+    }
+    free(heap->heapArr);
+    free(heap);
+}
+
+int mmheap_Insert( MMHEAP *heap, void *dataPtr)
+{
+    if (heap->last >= heap->capacity) {
+        void **newHeapArr = realloc(heap->heapArr, sizeof(void*) * heap->capacity * 2);
+        if (newHeapArr == NULL) return 0;
+        heap->heapArr = newHeapArr;
+        heap->capacity *= 2;
+    }
+
+    heap->heapArr[heap->last] = dataPtr;
+    _pushUp(heap, heap->last);
+    heap->last++;
+
+    return 1;
+}
+
+void *mmheap_FindMax( MMHEAP *heap)
+{
+    if (heap->last == 0) return NULL;
+
+    return heap->heapArr[0];
+}
+
+void *mmheap_FindMin( MMHEAP *heap)
+{
+    if (heap->last == 0) return NULL;
+
+    return heap->heapArr[_minIndex(heap)];
+}
+
+int mmheap_DeleteMax( MMHEAP *heap, void **dataOutPtr)
+{
+    if (heap->last == 0) {
+        *dataOutPtr = NULL;
+        return 0;
+    }
+
+    _deleteAt(heap, 0, dataOutPtr);
+
+    return 1;
+}
+
+int mmheap_DeleteMin( MMHEAP *heap, void **dataOutPtr)
+{
+    if (heap->last == 0) {
+        *dataOutPtr = NULL;
+        return 0;
+    }
+
+    _deleteAt(heap, _minIndex(heap), dataOutPtr);
+
+    return 1;
+}
+
+int mmheap_Empty( MMHEAP *heap)
+{
+    if (heap->last == 0) return 1;
+    else return 0;
+}
+
+int mmheap_Count( MMHEAP *heap)
+{
+    return heap->last;
+}
@@ -0,0 +1,48 @@
+// min-max heap (double-ended priority queue)
+// levels alternate between max levels (root, grandchildren, ...) and min levels (children of root, ...);
+// every node on a max level is the largest of its subtree and every node on a min level is the smallest,
+// so both extremes are found in O(1) and deleted in O(log n) from one array
+
+typedef struct
+{
+	int	last;
+	int	capacity;
+	void **heapArr;
+	int (*compare) (const void *, const void *);
+} MMHEAP;
+
+/* Allocates memory for heap and returns address of heap head structure
+if memory overflow, NULL returned
+*/
+MMHEAP *mmheap_Create( int (*compare) (const void *arg1, const void *arg2));
+
+/* Free memory for heap
+*/
+void mmheap_Destroy( MMHEAP *heap, void (*remove_data)(void *ptr));
+
+/* Inserts data into heap
+return 1 if successful; 0 if overflow
+*/
+int mmheap_Insert( MMHEAP *heap, void *dataPtr);
+
+/* Returns data with the highest / lowest priority (not deleted)
+return NULL if heap empty
+*/
+void *mmheap_FindMax( MMHEAP *heap);
+void *mmheap_FindMin( MMHEAP *heap);
+
+/* Deletes data with the highest / lowest priority and passes it back to caller
+return 1 if successful; 0 if heap empty
+*/
+int mmheap_DeleteMax( MMHEAP *heap, void **dataOutPtr);
+int mmheap_DeleteMin( MMHEAP *heap, void **dataOutPtr);
+
+/*
+return 1 if heap empty; 0 if not
+*/
+int mmheap_Empty( MMHEAP *heap);
+
+/*
+return number of data in heap
+*/
+int mmheap_Count( MMHEAP *heap);
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, aligned_alloc, free
+
+#include "adt_mqueue.h"
+
+// random number generator state of each thread
+static _Thread_local unsigned int seed = 0;
+
+/* xorshift random number generator
+*/
+static unsigned int _rand( void)
+{
+    if (seed == 0) seed = (unsigned int)(size_t)&seed | 1; // different for each thread
+
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+
+MQUEUE *mq_Create( int numQueues, int (*compare) (const void *arg1, const void *arg2))
+{
+    if (numQueues < 2) numQueues = 2;
+
+    MQUEUE *newmq = (MQUEUE*)malloc(sizeof(MQUEUE));
+    if (newmq == NULL) return NULL;
+
+    // sizeof(MQ_SLOT) is a multiple of the alignment, as aligned_alloc requires
+    newmq->queues = (MQ_SLOT *)aligned_alloc(MQ_CACHE_LINE, sizeof(MQ_SLOT) * numQueues);
+    if (newmq->queues == NULL) {
+        free(newmq);
+        return NULL;
+    }
+
+    for (int i = 0; i < numQueues; i++) {
+        newmq->queues[i].heap = heap_Create(compare);
+        if (newmq->queues[i].heap == NULL) {
+            while (--i >= 0) {
+                heap_Destroy(newmq->queues[i].heap, NULL); // empty heap: remove_data is not called
+                pthread_mutex_destroy(&newmq->queues[i].lock);
+            }
+            free(newmq->queues);
+            free(newmq);
+            return NULL;
+        }
+        pthread_mutex_init(&newmq->queues[i].lock, NULL);
+    }
+
+    newmq->numQueues = numQueues;
+    atomic_init(&newmq->count, 0);
+
+    return newmq;
+}
+
+void mq_Destroy( MQUEUE *mq, void (*remove_data)(void *ptr))
+{
+    for (int i = 0; i < mq->numQueues; i++) {
+        heap_Destroy(mq->queues[i].heap, remove_data);
+        pthread_mutex_destroy(&mq->queues[i].lock);
+    }
+    free(mq->queues);
+    free(mq);
+}
+
+int mq_Insert( MQUEUE *mq, void *dataPtr)
+{
+    MQ_SLOT *slot;
+
+    // random heap which is not locked by another thread
+    do {
+        slot = &mq->queues[_rand() % mq->numQueues];
+    } while (pthread_mutex_trylock(&slot->lock) != 0);
+
+    int ret = heap_Insert(slot->heap, dataPtr);
+    if (ret) atomic_fetch_add(&mq->count, 1);
+
+    pthread_mutex_unlock(&slot->lock);
+
+    return ret;
+}
+
+int mq_Delete( MQUEUE *mq, void **dataOutPtr)
+{
+    while (atomic_load(&mq->count) > 0) {
+        int i = _rand() % mq->numQueues;
+        int j = _rand() % mq->numQueues;
+        if (i == j) j = (j + 1) % mq->numQueues;
+
+        MQ_SLOT *a = &mq->queues[i];
+        MQ_SLOT *b = &mq->queues[j];
+
+        // never blocks while holding a lock (no deadlock)
+        if (pthread_mutex_trylock(&a->lock) != 0) continue;
+        if (pthread_mutex_trylock(&b->lock) != 0) {
+            pthread_mutex_unlock(&a->lock);
+            continue;
+        }
+
+        // better root of the two heaps
+        HEAP *heap = NULL;
+        if (!heap_Empty(a->heap)) heap = a->heap;
+        if (!heap_Empty(b->heap) &&
+            (heap == NULL || heap->compare(b->heap->heapArr[0], heap->heapArr[0]) > 0)) heap = b->heap;
+
+        int ret = 0;
+        if (heap != NULL) {
+            ret = heap_Delete(heap, dataOutPtr);
+            atomic_fetch_sub(&mq->count, 1);
+        }
+
+        pthread_mutex_unlock(&b->lock);
+        pthread_mutex_unlock(&a->lock);
+
+        if (ret) return 1;
+    }
+
+    *dataOutPtr = NULL;
+    return 0;
+}
+
+int mq_Empty( MQUEUE *mq)
+{
+    if (atomic_load(&mq->count) == 0) return 1;
+    else return 0;
+}
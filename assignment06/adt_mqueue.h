@@ -0,0 +1,50 @@
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "adt_heap.h"
+
+// concurrent (relaxed) priority queue: MultiQueue
+// data is spread over several HEAPs, each protected by its own lock.
+// insert puts data into a random heap; delete compares the roots of two random heaps and
+// deletes the better one, so the deleted data is close to (but not always) the highest priority
+
+#define MQ_CACHE_LINE	64
+
+// heap with its lock, aligned to a cache line (and its size rounded up to one) to avoid false sharing
+// (the array of slots is allocated with aligned_alloc)
+typedef struct
+{
+	_Alignas(MQ_CACHE_LINE) pthread_mutex_t	lock;
+	HEAP	*heap;
+} MQ_SLOT;
+
+typedef struct
+{
+	int	numQueues;
+	MQ_SLOT	*queues;
+	atomic_int	count; // number of data in all heaps
+} MQUEUE;
+
+/* Allocates memory for numQueues heaps (2 ~ 4 times the number of threads is recommended)
+if memory overflow, NULL returned
+*/
+MQUEUE *mq_Create( int numQueues, int (*compare) (const void *arg1, const void *arg2));
+
+/* Free memory for queue (no other thread should use the queue)
+*/
+void mq_Destroy( MQUEUE *mq, void (*remove_data)(void *ptr));
+
+/* Inserts data into queue (thread-safe)
+return 1 if successful; 0 if overflow
+*/
+int mq_Insert( MQUEUE *mq, void *dataPtr);
+
+/* Deletes data with high priority and passes it back to caller (thread-safe)
+return 1 if successful; 0 if queue empty
+*/
+int mq_Delete( MQUEUE *mq, void **dataOutPtr);
+
+/*
+return 1 if queue empty; 0 if not
+*/
+int mq_Empty( MQUEUE *mq);
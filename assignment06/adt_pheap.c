@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free
+
+#include "adt_pheap.h"
+
+/* Links two heaps: the root with lower priority becomes the leftmost child of the other
+   return root of the linked heap
+*/
+static int _link( HEAP *heap, int a, int b)
+{
+    PHNODE *nodes = heap->nodes;
+
+    if (heap->compare(nodes[b].dataPtr, nodes[a].dataPtr) > 0) {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+    nodes[b].sibling = nodes[a].child;
+    nodes[a].child = b;
+
+    return a;
+}
+
+/* Merges the list of subtrees starting at first (two-pass pairing)
+   for heap_Delete function
+   return root of the merged heap
+*/
+static int _mergePairs( HEAP *heap, int first)
+{
+    PHNODE *nodes = heap->nodes;
+    int paired = PH_NIL; // stack of pairs (linked by sibling)
+
+    // first pass: links pairs from left to right
+    while (first != PH_NIL) {
+        int a = first;
+        int b = nodes[a].sibling;
+
+        if (b == PH_NIL) {
+            nodes[a].sibling = paired;
+            paired = a;
+            break;
+        }
+
+        first = nodes[b].sibling;
+        nodes[a].sibling = PH_NIL;
+        nodes[b].sibling = PH_NIL;
+
+        int m = _link(heap, a, b);
+        nodes[m].sibling = paired;
+        paired = m;
+    }
+
+    // second pass: links pairs from right to left
+    int root = PH_NIL;
+    while (paired != PH_NIL) {
+        int next = nodes[paired].sibling;
+        nodes[paired].sibling = PH_NIL;
+
+        root = (root == PH_NIL) ? paired : _link(heap, paired, root);
+        paired = next;
+    }
+
+    return root;
+}
+
+/* Allocates a node from pool
+   return index of node; PH_NIL if overflow
+*/
+static int _makeNode( HEAP *heap, void *dataPtr)
+{
+    int n;
+
+    if (heap->freeList != PH_NIL) {
+        n = heap->freeList;
+        heap->freeList = heap->nodes[n].sibling;
+    }
+    else {
+        if (heap->numNodes >= heap->capacity && !heap_Reserve(heap, heap->capacity * 2)) return PH_NIL;
+        n = heap->numNodes++;
+    }
+
+    heap->nodes[n].dataPtr = dataPtr;
+    heap->nodes[n].child = PH_NIL;
+    heap->nodes[n].sibling = PH_NIL;
+
+    return n;
+}
+
+/* Removes data of every node (the links are destroyed)
+   each child list is spliced in front of the siblings of its parent, so no stack is needed
+   (ascending inserts make a child chain as long as the heap)
+   for heap_Destroy function
+*/
+static void _removeAll( HEAP *heap, void (*remove_data)(void *ptr))
+{
+    PHNODE *nodes = heap->nodes;
+    int n = heap->root;
+
+    while (n != PH_NIL) {
+        int child = nodes[n].child;
+
+        remove_data(nodes[n].dataPtr);
+        if (child != PH_NIL) {
+            int last = child;
+            while (nodes[last].sibling != PH_NIL) last = nodes[last].sibling;
+            nodes[last].sibling = nodes[n].sibling;
+            n = child;
+        }
+        else n = nodes[n].sibling;
+    }
+}
+
+/* Prints every node in preorder with an explicit stack of siblings to visit later
+   return 1 if successful; 0 if overflow
+   for heap_Print function
+*/
+static int _print( HEAP *heap, void (*print_func) (const void *data))
+{
+    int *stack = (int *)malloc(sizeof(int) * (heap->numNodes + 1));
+    int top = 0;
+    int n = heap->root;
+
+    if (stack == NULL) return 0;
+
+    while (n != PH_NIL || top > 0) {
+        if (n == PH_NIL) n = stack[--top];
+
+        print_func(heap->nodes[n].dataPtr);
+        if (heap->nodes[n].child != PH_NIL) {
+            if (heap->nodes[n].sibling != PH_NIL) stack[top++] = heap->nodes[n].sibling;
+            n = heap->nodes[n].child;
+        }
+        else n = heap->nodes[n].sibling;
+    }
+
+    free(stack);
+    return 1;
+}
+
+
+HEAP *heap_Create( int (*compare) (const void *arg1, const void *arg2))
+{
+    HEAP *newheap = (HEAP*)malloc(sizeof(HEAP));
+    if (newheap == NULL) return NULL;
+
+    newheap->capacity = 10;
+    newheap->compare = compare;
+    newheap->last = 0;
+    newheap->numNodes = 0;
+    newheap->freeList = PH_NIL;
+    newheap->root = PH_NIL;
+    newheap->nodes = (PHNODE *)malloc(sizeof(PHNODE) * newheap->capacity);
+
+    if (newheap->nodes == NULL) {
+        free(newheap);
+        return NULL;
+    }
+
+    return newheap;
+}
+
+void heap_Destroy( HEAP *heap, void (*remove_data)(void *ptr))
+{
+    if (remove_data) _removeAll(heap, remove_data);
+    free(heap->nodes);
+    free(heap);
+}
+
+int heap_Reserve( HEAP *heap, int capacity)
+{
+    if (capacity <= heap->capacity) return 1;
+
+    PHNODE *newNodes = realloc(heap->nodes, sizeof(PHNODE) * capacity);
+    if (newNodes == NULL) return 0; // Memory allocation failed
+
+    heap->nodes = newNodes;
+    heap->capacity = capacity;
+
+    return 1;
+}
+
+int heap_Build( HEAP *heap, void **array, int n)
+{
+    if (!heap_Reserve(heap, heap->numNodes + n)) return 0;
+
+    for (int i = 0; i < n; i++) {
+        if (!heap_Insert(heap, array[i])) return 0;
+    }
+
+    return 1;
+}
+
+int heap_Insert( HEAP *heap, void *dataPtr)
+{
+    int n = _makeNode(heap, dataPtr);
+    if (n == PH_NIL) return 0;
+
+    heap->root = (heap->root == PH_NIL) ? n : _link(heap, heap->root, n);
+    heap->last++;
+
+    return 1; // Successful insertion
+}
+
+int heap_Delete( HEAP *heap, void **dataOutPtr)
+{
+    if (heap->last == 0) {
+        *dataOutPtr = NULL; // Explicitly set to NULL
+        return 0; // Heap is empty
+    }
+
+    int old = heap->root;
+
+    *dataOutPtr = heap->nodes[old].dataPtr;
+    heap->root = _mergePairs(heap, heap->nodes[old].child);
+    heap->last--;
+
+    // recycles node
+    heap->nodes[old].sibling = heap->freeList;
+    heap->freeList = old;
+
+    return 1; // Successful deletion
+}
+
+int heap_Empty(  HEAP *heap)
+{
+    if (heap->last == 0) return 1;
+    else return 0;
+}
+
+void heap_Print( HEAP *heap, void (*print_func) (const void *data))
+{
+    _print(heap, print_func);
+    printf("\n");
+}
@@ -0,0 +1,62 @@
+// pairing heap with the same interface as adt_heap.h
+// (include this header instead of adt_heap.h and link adt_pheap.o)
+// nodes are kept in one array (pool) and linked by indices: leftmost child and next sibling
+
+#define PH_NIL	-1
+
+typedef struct
+{
+	void	*dataPtr;
+	int	child; // leftmost child
+	int	sibling; // next sibling (next free node if the node is free)
+} PHNODE;
+
+typedef struct
+{
+	int	last; // number of data in heap
+	int	capacity; // number of nodes in pool
+	PHNODE	*nodes; // node pool
+	int	numNodes; // # of nodes ever used in pool
+	int	freeList;
+	int	root;
+	int (*compare) (const void *, const void *);
+} HEAP;
+
+/* Allocates memory for heap and returns address of heap head structure
+if memory overflow, NULL returned
+The initial capacity of the heap should be 10
+*/
+HEAP *heap_Create( int (*compare) (const void *arg1, const void *arg2));
+
+/* Free memory for heap
+*/
+void heap_Destroy( HEAP *heap, void (*remove_data)(void *ptr));
+
+/* Inserts data into heap (O(1))
+return 1 if successful; 0 if heap full
+*/
+int heap_Insert( HEAP *heap, void *dataPtr);
+
+/* Makes sure the node pool can hold capacity elements without reallocation
+return 1 if successful; 0 if overflow
+*/
+int heap_Reserve( HEAP *heap, int capacity);
+
+/* Adds n data pointers in array to heap at once (O(n))
+the array itself is not kept by heap
+return 1 if successful; 0 if overflow
+*/
+int heap_Build( HEAP *heap, void **array, int n);
+
+/* Deletes root of heap and passes data back to caller (O(log n) amortized, two-pass pairing)
+return 1 if successful; 0 if heap empty
+*/
+int heap_Delete( HEAP *heap, void **dataOutPtr);
+
+/*
+return 1 if heap empty; 0 if not
+*/
+int heap_Empty(  HEAP *heap);
+
+/* Print heap (preorder) */
+void heap_Print( HEAP *heap, void (*print_func) (const void *data));
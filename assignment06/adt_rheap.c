@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free
+
+#include "adt_rheap.h"
+
+/* returns bucket number of key
+   0 if key == lastKey; otherwise (position of the highest differing bit) + 1
+*/
+static int _bucketOf( RHEAP *heap, unsigned int key)
+{
+    unsigned int diff = key ^ heap->lastKey;
+
+    if (diff == 0) return 0;
+    return 32 - __builtin_clz(diff);
+}
+
+/* Makes sure bucket can hold n more items
+   return 1 if successful; 0 if overflow
+*/
+static int _reserve( RBUCKET *bucket, int n)
+{
+    if (bucket->size + n <= bucket->capacity) return 1;
+
+    int capacity = (bucket->capacity == 0) ? 10 : bucket->capacity * 2;
+    if (capacity < bucket->size + n) capacity = bucket->size + n;
+
+    RITEM *newItems = realloc(bucket->items, sizeof(RITEM) * capacity);
+    if (newItems == NULL) return 0;
+
+    bucket->items = newItems;
+    bucket->capacity = capacity;
+
+    return 1;
+}
+
+/* Appends item to bucket
+   return 1 if successful; 0 if overflow
+*/
+static int _push( RBUCKET *bucket, unsigned int key, void *dataPtr)
+{
+    if (!_reserve(bucket, 1)) return 0;
+
+    bucket->items[bucket->size].key = key;
+    bucket->items[bucket->size].dataPtr = dataPtr;
+    bucket->size++;
+
+    return 1;
+}
+
+
+RHEAP *rheap_Create( unsigned int (*key) (const void *data))
+{
+    RHEAP *newheap = (RHEAP*)malloc(sizeof(RHEAP));
+    if (newheap == NULL) return NULL;
+
+    newheap->key = key;
+    newheap->last = 0;
+    newheap->lastKey = 0;
+
+    for (int i = 0; i < RH_BUCKETS; i++) {
+        newheap->buckets[i].size = 0;
+        newheap->buckets[i].capacity = 0;
+        newheap->buckets[i].items = NULL;
+    }
+
+    return newheap;
+}
+
+void rheap_Destroy( RHEAP *heap, void (*remove_data)(void *ptr))
+{
+    for (int i = 0; i < RH_BUCKETS; i++) {
+        for (int j = 0; j < heap->buckets[i].size; j++) {
+            remove_data(heap->buckets[i].items[j].dataPtr);
+        }
+        free(heap->buckets[i].items);
+    }
+    free(heap);
+}
+
+int rheap_Insert( RHEAP *heap, void *dataPtr)
+{
+    unsigned int key = heap->key(dataPtr);
+
+    if (key < heap->lastKey) return 0; // not monotone
+
+    if (!_push(&heap->buckets[_bucketOf(heap, key)], key, dataPtr)) return 0;
+    heap->last++;
+
+    return 1;
+}
+
+int rheap_Delete( RHEAP *heap, void **dataOutPtr)
+{
+    if (heap->last == 0) {
+        *dataOutPtr = NULL;
+        return 0; // Heap is empty
+    }
+
+    if (heap->buckets[0].size == 0) {
+        // first non-empty bucket
+        int i = 1;
+        while (heap->buckets[i].size == 0) i++;
+
+        RBUCKET *bucket = &heap->buckets[i];
+
+        // the smallest key in the bucket becomes the new lastKey
+        unsigned int minKey = bucket->items[0].key;
+        for (int j = 1; j < bucket->size; j++) {
+            if (bucket->items[j].key < minKey) minKey = bucket->items[j].key;
+        }
+        unsigned int oldKey = heap->lastKey;
+        heap->lastKey = minKey;
+
+        // reserves the lower buckets first, so that redistribution cannot fail halfway
+        int counts[RH_BUCKETS] = {0};
+        for (int j = 0; j < bucket->size; j++) {
+            counts[_bucketOf(heap, bucket->items[j].key)]++;
+        }
+        for (int b = 0; b < i; b++) {
+            if (!_reserve(&heap->buckets[b], counts[b])) {
+                heap->lastKey = oldKey;
+                *dataOutPtr = NULL;
+                return 0;
+            }
+        }
+
+        // redistributes the bucket; every item moves to a lower bucket
+        for (int j = 0; j < bucket->size; j++) {
+            RITEM *item = &bucket->items[j];
+            _push(&heap->buckets[_bucketOf(heap, item->key)], item->key, item->dataPtr);
+        }
+        bucket->size = 0;
+    }
+
+    *dataOutPtr = heap->buckets[0].items[--heap->buckets[0].size].dataPtr;
+    heap->last--;
+
+    return 1;
+}
+
+int rheap_Empty( RHEAP *heap)
+{
+    if (heap->last == 0) return 1;
+    else return 0;
+}
+
+void rheap_Print( RHEAP *heap, void (*print_func) (const void *data))
+{
+    for (int i = 0; i < RH_BUCKETS; i++) {
+        for (int j = 0; j < heap->buckets[i].size; j++) {
+            print_func(heap->buckets[i].items[j].dataPtr);
+        }
+    }
+    printf("\n");
+}
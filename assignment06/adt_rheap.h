@@ -0,0 +1,55 @@
+// radix heap for monotone unsigned integer priorities (min-heap)
+// the key of inserted data must not be smaller than the key of the last deleted data
+// (e.g. Dijkstra's shortest path, event scheduling)
+// data is kept in 33 buckets by the highest bit in which its key differs from the last deleted key
+
+#define RH_BUCKETS	33
+
+typedef struct
+{
+	unsigned int	key;
+	void	*dataPtr;
+} RITEM;
+
+typedef struct
+{
+	int	size;
+	int	capacity;
+	RITEM	*items;
+} RBUCKET;
+
+typedef struct
+{
+	int	last; // number of data in heap
+	unsigned int	lastKey; // key of the last deleted data
+	RBUCKET	buckets[RH_BUCKETS];
+	unsigned int (*key) (const void *);
+} RHEAP;
+
+/* Allocates memory for heap and returns address of heap head structure
+key function returns the priority of data (smaller key is deleted first)
+if memory overflow, NULL returned
+*/
+RHEAP *rheap_Create( unsigned int (*key) (const void *data));
+
+/* Free memory for heap
+*/
+void rheap_Destroy( RHEAP *heap, void (*remove_data)(void *ptr));
+
+/* Inserts data into heap (O(1))
+return 1 if successful; 0 if overflow or key is smaller than the last deleted key
+*/
+int rheap_Insert( RHEAP *heap, void *dataPtr);
+
+/* Deletes data with the smallest key and passes it back to caller (O(log C) amortized, C = key range)
+return 1 if successful; 0 if heap empty
+*/
+int rheap_Delete( RHEAP *heap, void **dataOutPtr);
+
+/*
+return 1 if heap empty; 0 if not
+*/
+int rheap_Empty( RHEAP *heap);
+
+/* Print heap (bucket order) */
+void rheap_Print( RHEAP *heap, void (*print_func) (const void *data));
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, atoi
+#include <time.h> // clock
+
+// priority queue benchmark on adt_heap.h
+// the same source is linked with each heap implementation (HEAP_NAME and HEAP_HEADER are set by Makefile)
+
+#ifndef HEAP_HEADER
+#define HEAP_HEADER	"adt_heap.h"
+#endif
+
+#include HEAP_HEADER
+
+#ifndef HEAP_NAME
+#define HEAP_NAME	"binary"
+#endif
+
+#define NUM_ELEM	1000000
+
+static long num_compares = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+/* user-defined compare function */
+int compare(const void *arg1, const void *arg2)
+{
+	int a1 = *(int *)arg1;
+	int a2 = *(int *)arg2;
+
+	num_compares++;
+	return (a1 > a2) - (a1 < a2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void remove_data(void *data)
+{
+	(void)data; // data is owned by the benchmark
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// xorshift random number generator (same sequence on every platform)
+static unsigned int seed = 2463534242u;
+
+static unsigned int next_rand(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void report( const char *trace, int ops, clock_t start)
+{
+	double sec = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf( "%-8s %-16s %8.1f ns/op %6.2f compares/op\n",
+		HEAP_NAME, trace, sec * 1e9 / ops, (double)num_compares / ops);
+	num_compares = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	int n = NUM_ELEM;
+	int *data;
+	HEAP *heap;
+	void *dataPtr;
+	int ok = 1;
+	clock_t start;
+
+	if (argc == 2) n = atoi( argv[1]);
+	if (n < 1)
+	{
+		fprintf( stderr, "usage: %s [NUM_ELEM]\n", argv[0]);
+		return 1;
+	}
+
+	// n keys for the first trace + n keys for the hold trace
+	data = malloc( sizeof( int) * n * 2);
+	for (int i = 0; i < n * 2; i++)
+		data[i] = next_rand() & 0x7fffffff;
+
+	heap = heap_Create( compare);
+
+	// n inserts
+	start = clock();
+	for (int i = 0; i < n; i++)
+		heap_Insert( heap, &data[i]);
+	report( "insert", n, start);
+
+	// hold model: delete max + insert (the size stays n)
+	start = clock();
+	for (int i = 0; i < n; i++)
+	{
+		heap_Delete( heap, &dataPtr);
+		data[n + i] = *(int *)dataPtr - (next_rand() & 0xffff); // new key is not larger
+		heap_Insert( heap, &data[n + i]);
+	}
+	report( "delete+insert", n * 2, start);
+
+	// n deletes
+	int prev = 0x7fffffff;
+	start = clock();
+	for (int i = 0; i < n; i++)
+	{
+		heap_Delete( heap, &dataPtr);
+		if (*(int *)dataPtr > prev) ok = 0;
+		prev = *(int *)dataPtr;
+	}
+	report( "delete", n, start);
+
+	if (!ok || !heap_Empty( heap)) printf( "%s: wrong order!\n", HEAP_NAME);
+
+	heap_Destroy( heap, remove_data);
+	free( data);
+
+	return 0;
+}
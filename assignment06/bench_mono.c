@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, atoi
+#include <time.h> // clock
+
+// monotone integer priority queue benchmark (shortest-path / scheduling style trace)
+// the same source is linked with the binary heap, the pairing heap (HEAP_HEADER="adt_pheap.h")
+// and the radix heap (USE_RHEAP); heaps are used as min-heaps
+
+#ifdef USE_RHEAP
+#include "adt_rheap.h"
+#define HEAP_NAME		"radix"
+#define HEAP			RHEAP
+#define heap_Create(f)	rheap_Create(key_of)
+#define heap_Insert		rheap_Insert
+#define heap_Delete		rheap_Delete
+#define heap_Empty		rheap_Empty
+#define heap_Destroy	rheap_Destroy
+#else
+#ifndef HEAP_HEADER
+#define HEAP_HEADER	"adt_heap.h"
+#endif
+#include HEAP_HEADER
+#endif
+
+#ifndef HEAP_NAME
+#define HEAP_NAME	"binary"
+#endif
+
+#define NUM_ELEM	100000 // # of elements in queue
+#define NUM_OPS		2000000 // # of delete-min + insert
+#define MAX_STEP	1000 // key increase per step
+
+typedef struct {
+	unsigned int	key; // priority (distance, time, ...)
+	int		id;
+} tItem;
+
+////////////////////////////////////////////////////////////////////////////////
+/* smaller key has higher priority (min-heap on adt_heap.h) */
+int compare_min(const void *arg1, const void *arg2)
+{
+	unsigned int k1 = ((tItem *)arg1)->key;
+	unsigned int k2 = ((tItem *)arg2)->key;
+
+	return (k2 > k1) - (k2 < k1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* key function for radix heap */
+unsigned int key_of(const void *data)
+{
+	return ((tItem *)data)->key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void remove_data(void *data)
+{
+	(void)data; // data is owned by the benchmark
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// xorshift random number generator (same sequence on every platform)
+static unsigned int seed = 2463534242u;
+
+static unsigned int next_rand(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	int n = NUM_ELEM;
+	int ops = NUM_OPS;
+	tItem *items;
+	HEAP *heap;
+	void *dataPtr;
+	unsigned int prev = 0;
+	int ok = 1;
+	clock_t start;
+	double sec;
+
+	if (argc >= 2) n = atoi( argv[1]);
+	if (argc >= 3) ops = atoi( argv[2]);
+	if (n < 1 || ops < 0)
+	{
+		fprintf( stderr, "usage: %s [NUM_ELEM [NUM_OPS]]\n", argv[0]);
+		return 1;
+	}
+
+	items = malloc( sizeof( tItem) * n);
+	heap = heap_Create( compare_min);
+
+	start = clock();
+
+	for (int i = 0; i < n; i++)
+	{
+		items[i].key = next_rand() % (MAX_STEP * 10);
+		items[i].id = i;
+		heap_Insert( heap, &items[i]);
+	}
+
+	// delete-min, then re-insert the element with a larger key (monotone)
+	for (int i = 0; i < ops; i++)
+	{
+		heap_Delete( heap, &dataPtr);
+
+		tItem *item = (tItem *)dataPtr;
+		if (item->key < prev) ok = 0;
+		prev = item->key;
+
+		item->key += next_rand() % MAX_STEP;
+		heap_Insert( heap, item);
+	}
+
+	while (!heap_Empty( heap))
+	{
+		heap_Delete( heap, &dataPtr);
+		if (((tItem *)dataPtr)->key < prev) ok = 0;
+		prev = ((tItem *)dataPtr)->key;
+	}
+
+	sec = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf( "%-8s %d elements, %d delete-min+insert: %.3fs (%.1f ns/op)%s\n",
+		HEAP_NAME, n, ops, sec, sec * 1e9 / (n * 2 + ops * 2), ok ? "" : " wrong order!");
+
+	heap_Destroy( heap, remove_data);
+	free( items);
+
+	return 0;
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, atoi
+#include <pthread.h>
+#include <time.h> // clock_gettime
+
+#include "adt_mqueue.h"
+
+// throughput of the MultiQueue vs. a single HEAP protected by one lock
+// every thread alternates insert and delete on a prefilled queue
+
+#define NUM_PREFILL		1000000
+#define OPS_PER_THREAD	1000000
+
+typedef struct {
+	int		id;
+	int		*keys; // keys owned by the thread
+} tWorker;
+
+static MQUEUE *mq;
+static HEAP *global_heap;
+static pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+static int use_mq;
+
+////////////////////////////////////////////////////////////////////////////////
+/* user-defined compare function */
+int compare(const void *arg1, const void *arg2)
+{
+	int a1 = *(int *)arg1;
+	int a2 = *(int *)arg2;
+
+	return (a1 > a2) - (a1 < a2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void remove_data(void *data)
+{
+	(void)data; // data is owned by the benchmark
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void *worker_main( void *arg)
+{
+	tWorker *w = (tWorker *)arg;
+	void *dataPtr;
+
+	for (int i = 0; i < OPS_PER_THREAD; i++)
+	{
+		if (use_mq)
+		{
+			mq_Insert( mq, &w->keys[i]);
+			mq_Delete( mq, &dataPtr);
+		}
+		else
+		{
+			pthread_mutex_lock( &global_lock);
+			heap_Insert( global_heap, &w->keys[i]);
+			pthread_mutex_unlock( &global_lock);
+
+			pthread_mutex_lock( &global_lock);
+			heap_Delete( global_heap, &dataPtr);
+			pthread_mutex_unlock( &global_lock);
+		}
+	}
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// runs num_threads workers and prints throughput (insert + delete per second)
+void measure( int num_threads, int *prefill, int **keys)
+{
+	pthread_t threads[64];
+	tWorker workers[64];
+	double start, sec;
+
+	if (use_mq)
+	{
+		mq = mq_Create( num_threads * 2, compare);
+		for (int i = 0; i < NUM_PREFILL; i++) mq_Insert( mq, &prefill[i]);
+	}
+	else
+	{
+		global_heap = heap_Create( compare);
+		for (int i = 0; i < NUM_PREFILL; i++) heap_Insert( global_heap, &prefill[i]);
+	}
+
+	start = now();
+	for (int i = 0; i < num_threads; i++)
+	{
+		workers[i].id = i;
+		workers[i].keys = keys[i];
+		pthread_create( &threads[i], NULL, worker_main, &workers[i]);
+	}
+	for (int i = 0; i < num_threads; i++)
+		pthread_join( threads[i], NULL);
+	sec = now() - start;
+
+	printf( "%-10s %2d threads: %6.2f Mops/s\n",
+		use_mq ? "multiqueue" : "locked", num_threads, 2.0 * OPS_PER_THREAD * num_threads / sec / 1e6);
+
+	if (use_mq) mq_Destroy( mq, remove_data);
+	else heap_Destroy( global_heap, remove_data);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	int max_threads = 8;
+	int *prefill;
+	int *keys[64];
+
+	if (argc == 2) max_threads = atoi( argv[1]);
+	if (max_threads < 1 || max_threads > 64)
+	{
+		fprintf( stderr, "usage: %s [MAX_THREADS (1 ~ 64)]\n", argv[0]);
+		return 1;
+	}
+
+	srand( 1);
+	prefill = malloc( sizeof( int) * NUM_PREFILL);
+	for (int i = 0; i < NUM_PREFILL; i++) prefill[i] = rand();
+
+	for (int t = 0; t < max_threads; t++)
+	{
+		keys[t] = malloc( sizeof( int) * OPS_PER_THREAD);
+		for (int i = 0; i < OPS_PER_THREAD; i++) keys[t][i] = rand();
+	}
+
+	for (use_mq = 0; use_mq <= 1; use_mq++)
+		for (int n = 1; n <= max_threads; n *= 2)
+			measure( n, prefill, keys);
+
+	for (int t = 0; t < max_threads; t++)
+		free( keys[t]);
+	free( prefill);
+
+	return 0;
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, atoi
+#include <time.h> // clock
+
+// bench_heap.c traces on the typed heap (theap.h): ints stored by value, comparison inlined
+// the output can be compared line by line with bench_heap
+
+#include "theap.h"
+
+#define NUM_ELEM	1000000
+
+static long num_compares = 0;
+
+#define int_less(a, b)	(num_compares++, (a) < (b))
+
+HEAP_DEFINE( IH, int, int_less)
+
+////////////////////////////////////////////////////////////////////////////////
+// xorshift random number generator (same sequence on every platform)
+static unsigned int seed = 2463534242u;
+
+static unsigned int next_rand(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void report( const char *trace, int ops, clock_t start)
+{
+	double sec = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf( "%-8s %-16s %8.1f ns/op %6.2f compares/op\n",
+		"typed", trace, sec * 1e9 / ops, (double)num_compares / ops);
+	num_compares = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	int n = NUM_ELEM;
+	int *data;
+	IH_HEAP *heap;
+	int top = 0;
+	int ok = 1;
+	clock_t start;
+
+	if (argc == 2) n = atoi( argv[1]);
+	if (n < 1)
+	{
+		fprintf( stderr, "usage: %s [NUM_ELEM]\n", argv[0]);
+		return 1;
+	}
+
+	data = malloc( sizeof( int) * n);
+	for (int i = 0; i < n; i++)
+		data[i] = next_rand() & 0x7fffffff;
+
+	heap = IH_Create();
+
+	// n inserts
+	start = clock();
+	for (int i = 0; i < n; i++)
+		IH_Insert( heap, data[i]);
+	report( "insert", n, start);
+
+	// hold model: delete max + insert (the size stays n)
+	start = clock();
+	for (int i = 0; i < n; i++)
+	{
+		IH_Delete( heap, &top);
+		IH_Insert( heap, top - (int)(next_rand() & 0xffff)); // new key is not larger
+	}
+	report( "delete+insert", n * 2, start);
+
+	// n deletes
+	int prev = 0x7fffffff;
+	start = clock();
+	for (int i = 0; i < n; i++)
+	{
+		IH_Delete( heap, &top);
+		if (top > prev) ok = 0;
+		prev = top;
+	}
+	report( "delete", n, start);
+
+	if (!ok || !IH_Empty( heap)) printf( "typed: wrong order!\n");
+
+	IH_Destroy( heap);
+	free( data);
+
+	return 0;
+}
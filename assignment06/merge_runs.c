@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free
+#include <string.h> // strcmp, strcpy
+
+#include "adt_heap.h"
+
+// external k-way merge of sorted word-frequency runs
+// each run file has "word\tfreq" lines sorted by word (strcmp order);
+// the output is one sorted file in which equal words are merged by summing frequencies.
+// only the current line of each run is kept in memory, so the runs can be larger than RAM
+
+#define MAX_WORD	256
+#define BUF_SIZE	(1 << 20) // stdio buffer size for each file
+
+// run structure
+typedef struct {
+	FILE	*fp;
+	char	*buf; // stdio buffer
+	const char	*name;
+	int		id; // order of the run (for equal words)
+	char	word[MAX_WORD]; // current word
+	long	freq; // current frequency
+} tRun;
+
+////////////////////////////////////////////////////////////////////////////////
+// compares current words of two runs
+// heap is a max-heap, so the smaller word has the higher priority
+int compare_by_word( const void *n1, const void *n2)
+{
+	tRun *p1 = (tRun *)n1;
+	tRun *p2 = (tRun *)n2;
+
+	int cmp = strcmp( p2->word, p1->word);
+	if (cmp != 0) return cmp;
+
+	return p2->id - p1->id;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// reads next line of run
+// return	1 success
+//			0 end of run
+//			-1 if the run is not sorted or the line is malformed
+int next_record( tRun *run)
+{
+	char prev[MAX_WORD];
+	int ret;
+
+	strcpy( prev, run->word);
+
+	ret = fscanf( run->fp, "%255s\t%ld", run->word, &run->freq);
+	if (ret == EOF) return 0;
+	if (ret != 2)
+	{
+		fprintf( stderr, "%s: malformed line after [%s]\n", run->name, prev);
+		return -1;
+	}
+	if (prev[0] && strcmp( prev, run->word) > 0)
+	{
+		fprintf( stderr, "%s: not sorted ([%s] after [%s])\n", run->name, run->word, prev);
+		return -1;
+	}
+	return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void close_run( tRun *run)
+{
+	fclose( run->fp);
+	free( run->buf);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void remove_run( void *run)
+{
+	close_run( (tRun *)run);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// reads next line of run and puts the run back into heap (closes the run at its end)
+// return	0 success or end of run
+//			3 if the run is not sorted or the line is malformed
+//			100 if the heap is full
+int advance_run( HEAP *heap, tRun *run)
+{
+	int next = next_record( run);
+
+	if (next == 1)
+	{
+		if (heap_Insert( heap, run)) return 0;
+		fprintf( stderr, "%s: cannot insert into the heap\n", run->name);
+		close_run( run);
+		return 100;
+	}
+	close_run( run);
+
+	return (next == -1) ? 3 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	HEAP *heap;
+	tRun *runs;
+	int num_runs = argc - 2;
+	void *dataPtr;
+	FILE *out;
+	char *out_buf;
+	char word[MAX_WORD] = "";
+	long freq = 0;
+	long num_out = 0;
+	int ret = 0;
+
+	if (argc < 3)
+	{
+		fprintf( stderr, "usage: %s OUTPUT RUN1 [RUN2 ...]\n", argv[0]);
+		return 1;
+	}
+
+	heap = heap_Create( compare_by_word);
+	runs = malloc( sizeof( tRun) * num_runs);
+	if (heap == NULL || runs == NULL || !heap_Reserve( heap, num_runs))
+	{
+		fprintf( stderr, "Cannot create a heap\n");
+		if (heap) heap_Destroy( heap, NULL);
+		free( runs);
+		return 100;
+	}
+
+	for (int i = 0; i < num_runs; i++)
+	{
+		tRun *run = &runs[i];
+
+		run->name = argv[i + 2];
+		run->id = i;
+		run->word[0] = 0;
+		run->fp = fopen( run->name, "rt");
+		if (run->fp == NULL)
+		{
+			fprintf( stderr, "file open error: %s\n", run->name);
+			heap_Destroy( heap, remove_run); // closes the runs opened so far
+			free( runs);
+			return 2;
+		}
+		run->buf = malloc( BUF_SIZE);
+		if (run->buf) setvbuf( run->fp, run->buf, _IOFBF, BUF_SIZE);
+
+		int err = advance_run( heap, run);
+		if (err > ret) ret = err;
+	}
+
+	out = fopen( argv[1], "wt");
+	if (out == NULL)
+	{
+		fprintf( stderr, "file open error: %s\n", argv[1]);
+		heap_Destroy( heap, remove_run);
+		free( runs);
+		return 2;
+	}
+	out_buf = malloc( BUF_SIZE);
+	if (out_buf) setvbuf( out, out_buf, _IOFBF, BUF_SIZE);
+
+	while (heap_Delete( heap, &dataPtr))
+	{
+		tRun *run = (tRun *)dataPtr;
+
+		if (strcmp( word, run->word) == 0)
+		{
+			freq += run->freq; // same word from another run (or repeated in a run)
+		}
+		else
+		{
+			if (word[0])
+			{
+				fprintf( out, "%s\t%ld\n", word, freq);
+				num_out++;
+			}
+			strcpy( word, run->word);
+			freq = run->freq;
+		}
+
+		int err = advance_run( heap, run);
+		if (err > ret) ret = err;
+	}
+	if (word[0])
+	{
+		fprintf( out, "%s\t%ld\n", word, freq);
+		num_out++;
+	}
+
+	// buffered write errors (e.g. disk full) show up only here
+	int werr = ferror( out);
+	if (fclose( out) != 0) werr = 1;
+	free( out_buf);
+
+	if (werr)
+	{
+		fprintf( stderr, "file write error: %s\n", argv[1]);
+		ret = 2;
+	}
+	else
+		fprintf( stderr, "%d runs merged into %ld words\n", num_runs, num_out);
+
+	heap_Destroy( heap, remove_run);
+	free( runs);
+
+	return ret;
+}
@@ -1,42 +1,37 @@
 #include <stdio.h>
-#include <stdlib.h> // malloc, rand, free
+#include <stdlib.h> // rand
 #include <time.h> // time
 
-#include "adt_heap.h"
+#include "theap.h"
 
 #define MAX_ELEM	20
 
-/* user-defined compare function */
-int compare(const void *arg1, const void *arg2)
-{
-	int *a1 = (int *)arg1;
-	int *a2 = (int *)arg2;
-	
-	return *a1 - *a2;
-}
+/* user-defined priority: larger numbers first (same order as compare of adt_heap.h) */
+#define int_less(a, b)	((a) < (b))
 
-////////////////////////////////////////////////////////////////////////////////
-/* user-defined print function */
-void print_func(const void *data)
-{
-	printf("%4d", *(int *)data);
-}
+// typed heap of int (IH_HEAP, IH_Create, IH_Insert, ...): numbers are stored by value
+HEAP_DEFINE( IH, int, int_less)
 
 ////////////////////////////////////////////////////////////////////////////////
-void remove_data(void *data)
+/* user-defined print function */
+void print_func(int data)
 {
-	free(data);
+	printf("%4d", data);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 int main(void)
 {
-	HEAP *heap;
+	IH_HEAP *heap;
 	int data;
-	void *dataPtr;
 	int i;
 	
-	heap = heap_Create(compare);
+	heap = IH_Create();
+	if (heap == NULL)
+	{
+		fprintf(stderr, "Cannot create a heap\n");
+		return 100;
+	}
 	
 	srand(time(NULL));
 	
@@ -48,31 +43,26 @@ int main(void)
 		
 		fprintf(stdout, "%4d", data);
 		
-		int *newdata = (int *)malloc( sizeof(int));
-		*newdata = data;
-		
 		// insert function call
-		if (heap_Insert(heap, newdata) == 0) break;
+		if (IH_Insert(heap, data) == 0) break;
  	}
 	printf("\n");
 	
 	printf( "Heap:  ");
-	heap_Print(heap, print_func);
+	IH_Print(heap, print_func);
 	
 	printf( "Delete:");
 	
-	while (!heap_Empty( heap))
+	while (!IH_Empty( heap))
 	{
 		// delete function call
-		heap_Delete(heap, &dataPtr);
-
-		printf("%4d", *(int *)dataPtr);
+		IH_Delete(heap, &data);
 
-		remove_data(dataPtr);
+		printf("%4d", data);
  	}
 	printf("\n");
 	
-	heap_Destroy(heap, remove_data);
+	IH_Destroy(heap);
 
 	return 0;
 }
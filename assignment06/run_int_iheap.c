@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, rand, free
+#include <time.h> // time
+
+#include "adt_iheap.h"
+
+#define MAX_ELEM	20
+
+/* user-defined compare function */
+int compare(const void *arg1, const void *arg2)
+{
+	int *a1 = (int *)arg1;
+	int *a2 = (int *)arg2;
+	
+	return *a1 - *a2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void remove_data(void *data)
+{
+	free(data);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+	IHEAP *heap;
+	int handles[MAX_ELEM];
+	void *dataPtr;
+	int i;
+	
+	heap = iheap_Create(compare);
+	
+	srand(time(NULL));
+	
+	printf("Insert:  ");
+	
+	for (i = 0; i < MAX_ELEM; i++)
+	{
+		int *newdata = (int *)malloc( sizeof(int));
+		*newdata = rand() % (MAX_ELEM * 3) + 1; // 1 ~ MAX_ELEM*3 random number
+		
+		fprintf(stdout, "%4d", *newdata);
+		
+		// insert function call
+		if ((handles[i] = iheap_Insert(heap, newdata)) == -1) break;
+ 	}
+	printf("\n");
+	
+	// changes priorities of some elements through their handles
+	printf("Update:  ");
+	for (i = 0; i < MAX_ELEM; i += 4)
+	{
+		int *data = (int *)iheap_Get(heap, handles[i]);
+		int old = *data;
+		
+		*data = rand() % (MAX_ELEM * 3) + 1;
+		if (*data >= old) iheap_IncreaseKey(heap, handles[i], data);
+		else iheap_DecreaseKey(heap, handles[i], data);
+		
+		printf(" %d->%d", old, *data);
+	}
+	printf("\n");
+	
+	// removes an element through its handle
+	iheap_Remove(heap, handles[MAX_ELEM - 1], &dataPtr);
+	printf("Remove:  %4d\n", *(int *)dataPtr);
+	remove_data(dataPtr);
+	
+	printf("Delete:  ");
+	
+	while (!iheap_Empty( heap))
+	{
+		// delete function call
+		iheap_Delete(heap, &dataPtr);
+
+		printf("%4d", *(int *)dataPtr);
+
+		remove_data(dataPtr);
+ 	}
+	printf("\n");
+	
+	iheap_Destroy(heap, remove_data);
+
+	return 0;
+}
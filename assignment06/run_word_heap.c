@@ -68,6 +68,9 @@ int main( int argc, char **argv)
 	char word[100];
 	int freq;
 	tWord *pWord;
+	void **words;
+	int num_words = 0;
+	int capacity = 1024;
 	FILE *fp;
 	
 	if (argc != 2)
@@ -86,20 +89,42 @@ int main( int argc, char **argv)
 	
 	printf("Insert:");
 	
-	while(fscanf(fp, "%s\t%d", word, &freq) != EOF)
+	// 입력 단어를 모두 읽은 후 한번에 heap 구성 (O(n))
+	words = (void **)malloc(sizeof(void *) * capacity);
+	if (words == NULL)
+	{
+		fprintf( stderr, "Cannot allocate memory for words\n");
+		heap_Destroy(heap, destroyWord);
+		fclose(fp);
+		return 100;
+	}
+	
+	while(fscanf(fp, "%99s\t%d", word, &freq) == 2)
 	{
 		printf(" %s", word); // 입력 단어
 		pWord = createWord(word, freq);
 		
-		// insert function call
-		if (heap_Insert(heap, pWord) == 0) {
-			destroyWord(pWord);
-			break;
+		if (num_words == capacity) {
+			void **newWords = realloc(words, sizeof(void *) * capacity * 2);
+			if (newWords == NULL) {
+				destroyWord(pWord);
+				break;
+			}
+			words = newWords;
+			capacity *= 2;
 		}
+		words[num_words++] = pWord;
  	}
 	printf("\n");
 	fclose(fp);
 	
+	// build function call
+	if (heap_Build(heap, words, num_words) == 0) {
+		for (int i = 0; i < num_words; i++)
+			destroyWord(words[i]);
+	}
+	free(words);
+	
 	printf("Heap:  ");
 	heap_Print(heap, print_word_only);
 	
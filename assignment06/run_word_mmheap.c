@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h> // strdup, strcmp
+#include <stdlib.h> // malloc, free, atoi
+#include "adt_mmheap.h"
+
+// 빈도 상위 K개와 하위 K개를 하나의 min-max heap으로 출력
+// usage: run_word_mmheap FILE [K]
+
+#define DEFAULT_K	10
+
+// User structure type definition
+// 단어 구조체
+typedef struct {
+	char	*word;		// 단어
+	int		freq;		// 빈도
+} tWord;
+
+////////////////////////////////////////////////////////////////////////////////
+// 단어 구조체를 위한 메모리를 할당하고 word, freq 초기화
+// return	할당된 단어 구조체에 대한 pointer
+//			NULL if overflow
+tWord *createWord( char *word, int freq)
+{
+	tWord *newWord = malloc( sizeof( tWord));
+	
+	if (newWord == NULL) return NULL;
+	
+	newWord->word = strdup( word);
+	newWord->freq = freq;
+	
+	return newWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 단어 구조체에 할당된 메모리를 해제
+void destroyWord( void *pWord)
+{
+	free( ((tWord *)pWord)->word);
+	free( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// compares two words in word structures
+// 정렬 기준 : 빈도, 빈도가 같으면 단어 역순 (사전순으로 앞선 단어가 우선)
+int compare_by_freq( const void *n1, const void *n2)
+{
+	tWord *p1 = (tWord *)n1;
+	tWord *p2 = (tWord *)n2;
+	
+	if (p1->freq != p2->freq) return p1->freq - p2->freq;
+	
+	return strcmp( p2->word, p1->word);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// prints contents of word structure
+void print_word(const void *dataPtr)
+{
+	printf( "%s\t%d\n", ((tWord *)dataPtr)->word, ((tWord *)dataPtr)->freq);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	MMHEAP *heap;
+	void *dataPtr;
+	
+	char word[100];
+	int freq;
+	int k = DEFAULT_K;
+	FILE *fp;
+	
+	if (argc != 2 && argc != 3)
+	{
+		fprintf(stderr, "usage: %s FILE [K]\n", argv[0]);
+		return 1;
+	}
+	if (argc == 3) k = atoi(argv[2]);
+		
+	if ((fp = fopen(argv[1], "rt")) == NULL)
+	{
+		fprintf( stderr, "file open error: %s\n", argv[1]);
+		return 2;
+	}
+	
+	heap = mmheap_Create(compare_by_freq);
+	
+	while(fscanf(fp, "%99s\t%d", word, &freq) == 2)
+	{
+		tWord *pWord = createWord(word, freq);
+		
+		if (mmheap_Insert(heap, pWord) == 0)
+		{
+			destroyWord(pWord);
+			break;
+		}
+ 	}
+	fclose(fp);
+	
+	printf("Top %d:\n", k);
+	for (int i = 0; i < k && mmheap_DeleteMax(heap, &dataPtr); i++)
+	{
+		print_word(dataPtr);
+		destroyWord(dataPtr);
+	}
+	
+	printf("Bottom %d:\n", k);
+	for (int i = 0; i < k && mmheap_DeleteMin(heap, &dataPtr); i++)
+	{
+		print_word(dataPtr);
+		destroyWord(dataPtr);
+	}
+	
+	mmheap_Destroy(heap, destroyWord);
+	
+	return 0;
+}
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <string.h> // strdup, strcmp
+#include <stdlib.h> // malloc, realloc, free, atoi
+#include "adt_heap.h"
+
+// 빈도순 출력 (heap_Sort / heap_PartialSort)
+// usage: run_word_sort FILE [K]
+// K가 주어지면 빈도 상위 K개만 정렬 (O(n + K log n))
+
+// User structure type definition
+// 단어 구조체
+typedef struct {
+	char	*word;		// 단어
+	int		freq;		// 빈도
+} tWord;
+
+////////////////////////////////////////////////////////////////////////////////
+// 단어 구조체를 위한 메모리를 할당하고 word, freq 초기화
+// return	할당된 단어 구조체에 대한 pointer
+//			NULL if overflow
+tWord *createWord( char *word, int freq)
+{
+	tWord *newWord = malloc( sizeof( tWord));
+	
+	if (newWord == NULL) return NULL;
+	
+	newWord->word = strdup( word);
+	newWord->freq = freq;
+	
+	return newWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 단어 구조체에 할당된 메모리를 해제
+void destroyWord( void *pWord)
+{
+	free( ((tWord *)pWord)->word);
+	free( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// compares two words in word structures
+// 정렬 기준 : 빈도 내림차순, 단어 오름차순
+int compare_by_freq( const void *n1, const void *n2)
+{
+	tWord *p1 = (tWord *)n1;
+	tWord *p2 = (tWord *)n2;
+	
+	if (p1->freq != p2->freq) return p1->freq - p2->freq;
+	
+	return strcmp( p2->word, p1->word);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// prints contents of word structure
+void print_word(const void *dataPtr)
+{
+	printf( "%s\t%d\n", ((tWord *)dataPtr)->word, ((tWord *)dataPtr)->freq);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	char word[100];
+	int freq;
+	tWord *pWord;
+	void **words;
+	int num_words = 0;
+	int capacity = 1024;
+	int k = -1;
+	FILE *fp;
+	
+	if (argc != 2 && argc != 3)
+	{
+		fprintf(stderr, "usage: %s FILE [K]\n", argv[0]);
+		return 1;
+	}
+	if (argc == 3) k = atoi(argv[2]);
+		
+	if ((fp = fopen(argv[1], "rt")) == NULL)
+	{
+		fprintf( stderr, "file open error: %s\n", argv[1]);
+		return 2;
+	}
+	
+	words = (void **)malloc(sizeof(void *) * capacity);
+	
+	while(fscanf(fp, "%99s\t%d", word, &freq) == 2)
+	{
+		pWord = createWord(word, freq);
+		
+		if (num_words == capacity) {
+			void **newWords = realloc(words, sizeof(void *) * capacity * 2);
+			if (newWords == NULL) {
+				destroyWord(pWord);
+				break;
+			}
+			words = newWords;
+			capacity *= 2;
+		}
+		words[num_words++] = pWord;
+ 	}
+	fclose(fp);
+	
+	// 배열 자체를 정렬 (추가 메모리 없음)
+	if (k < 0 || k >= num_words)
+	{
+		heap_Sort(words, num_words, compare_by_freq);
+		k = num_words;
+	}
+	else heap_PartialSort(words, num_words, k, compare_by_freq);
+	
+	for (int i = 0; i < k; i++)
+		print_word(words[i]);
+	
+	for (int i = 0; i < num_words; i++)
+		destroyWord(words[i]);
+	free(words);
+	
+	return 0;
+}
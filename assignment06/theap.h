@@ -0,0 +1,152 @@
+// typed heap generator
+// elements are stored by value in a contiguous array and compared by an inlined "less" (no void *, no function pointer)
+// like HEAP, the root is the largest element by "less"
+//
+// usage:
+//	#define int_less(a, b)	((a) < (b))
+//	HEAP_DEFINE( IH, int, int_less)	// IH_HEAP, IH_Create, IH_Insert, ...
+//
+// less( a, b) is a macro or an inline function returning nonzero if a has lower priority than b
+// HEAP_DEFINE can be used several times with different names in one source file
+
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free
+
+#define HEAP_DEFINE( name, T, less)	\
+\
+typedef struct	\
+{	\
+	int	last;	\
+	int	capacity;	\
+	T	*heapArr;	\
+} name##_HEAP;	\
+\
+/* Reestablishes heap by moving element at index up (hole-based, see adt_heap.c) */	\
+static inline void name##_reheapUp( name##_HEAP *heap, int index)	\
+{	\
+	T data = heap->heapArr[index];	\
+\
+	while (index > 0) {	\
+		int parent = (index - 1) / 2;	\
+		if (!less( heap->heapArr[parent], data)) break;	\
+		heap->heapArr[index] = heap->heapArr[parent];	\
+		index = parent;	\
+	}	\
+	heap->heapArr[index] = data;	\
+}	\
+\
+/* Reestablishes heap by moving element at index down */	\
+static inline void name##_reheapDown( name##_HEAP *heap, int index)	\
+{	\
+	T data = heap->heapArr[index];	\
+	int child;	\
+\
+	while ((child = 2 * index + 1) < heap->last) {	\
+		if (child + 1 < heap->last && less( heap->heapArr[child], heap->heapArr[child + 1])) child++;	\
+		if (!less( data, heap->heapArr[child])) break;	\
+		heap->heapArr[index] = heap->heapArr[child];	\
+		index = child;	\
+	}	\
+	heap->heapArr[index] = data;	\
+}	\
+\
+/* Places data into the hole at the root (Floyd's bounce, see adt_heap.c) */	\
+static inline void name##_reheapBounce( name##_HEAP *heap, T data)	\
+{	\
+	int index = 0;	\
+	int child;	\
+\
+	while ((child = 2 * index + 1) < heap->last) {	\
+		if (child + 1 < heap->last && less( heap->heapArr[child], heap->heapArr[child + 1])) child++;	\
+		heap->heapArr[index] = heap->heapArr[child];	\
+		index = child;	\
+	}	\
+	heap->heapArr[index] = data;	\
+	name##_reheapUp( heap, index);	\
+}	\
+\
+/* Allocates memory for heap (initial capacity 10)	\
+if memory overflow, NULL returned */	\
+static inline name##_HEAP *name##_Create( void)	\
+{	\
+	name##_HEAP *heap = (name##_HEAP *)malloc( sizeof( name##_HEAP));	\
+	if (heap == NULL) return NULL;	\
+\
+	heap->last = 0;	\
+	heap->capacity = 10;	\
+	heap->heapArr = (T *)malloc( sizeof( T) * heap->capacity);	\
+	if (heap->heapArr == NULL) {	\
+		free( heap);	\
+		return NULL;	\
+	}	\
+	return heap;	\
+}	\
+\
+/* Free memory for heap (elements are stored by value) */	\
+static inline void name##_Destroy( name##_HEAP *heap)	\
+{	\
+	free( heap->heapArr);	\
+	free( heap);	\
+}	\
+\
+/* Makes sure heapArr can hold capacity elements without reallocation	\
+return 1 if successful; 0 if overflow */	\
+static inline int name##_Reserve( name##_HEAP *heap, int capacity)	\
+{	\
+	if (capacity <= heap->capacity) return 1;	\
+\
+	T *newHeapArr = (T *)realloc( heap->heapArr, sizeof( T) * capacity);	\
+	if (newHeapArr == NULL) return 0;	\
+\
+	heap->heapArr = newHeapArr;	\
+	heap->capacity = capacity;	\
+	return 1;	\
+}	\
+\
+/* Inserts a copy of data into heap	\
+return 1 if successful; 0 if overflow */	\
+static inline int name##_Insert( name##_HEAP *heap, T data)	\
+{	\
+	if (heap->last >= heap->capacity && !name##_Reserve( heap, heap->capacity * 2)) return 0;	\
+\
+	heap->heapArr[heap->last] = data;	\
+	name##_reheapUp( heap, heap->last);	\
+	heap->last++;	\
+	return 1;	\
+}	\
+\
+/* Adds n elements in array to heap and rebuilds heap bottom-up (Floyd's method)	\
+return 1 if successful; 0 if overflow */	\
+static inline int name##_Build( name##_HEAP *heap, const T *array, int n)	\
+{	\
+	if (!name##_Reserve( heap, heap->last + n)) return 0;	\
+\
+	for (int i = 0; i < n; i++) heap->heapArr[heap->last++] = array[i];	\
+	for (int i = heap->last / 2 - 1; i >= 0; i--) name##_reheapDown( heap, i);	\
+	return 1;	\
+}	\
+\
+/* Deletes root of heap and copies it to *dataOut	\
+return 1 if successful; 0 if heap empty */	\
+static inline int name##_Delete( name##_HEAP *heap, T *dataOut)	\
+{	\
+	if (heap->last == 0) return 0;	\
+\
+	*dataOut = heap->heapArr[0];	\
+	heap->last--;	\
+	if (heap->last > 0) name##_reheapBounce( heap, heap->heapArr[heap->last]);	\
+	return 1;	\
+}	\
+\
+/* return 1 if heap empty; 0 if not */	\
+static inline int name##_Empty( name##_HEAP *heap)	\
+{	\
+	return heap->last == 0;	\
+}	\
+\
+/* Prints elements in array order with print_func (for debugging) */	\
+static inline void name##_Print( name##_HEAP *heap, void (*print_func) (T data))	\
+{	\
+	for (int i = 0; i < heap->last; i++) print_func( heap->heapArr[i]);	\
+	printf( "\n");	\
+}
@@ -68,6 +68,44 @@ static NODE *_makeNode( void *dataInPtr)
     return newnode;
 }
 
+// used in _build
+// frees nodes only (data is not touched)
+static void _freeNodes( NODE *root)
+{
+    if (root == NULL) return;
+
+    _freeNodes(root->left);
+    _freeNodes(root->right);
+    free(root);
+}
+
+// used in AVLT_BuildFromSorted
+// builds subtree from dataArr[lo..hi] with the middle element as root
+// return	pointer to root
+//			NULL if overflow (partially built nodes are freed)
+static NODE *_build( void **dataArr, int lo, int hi, int *overflow)
+{
+    if (lo > hi) return NULL;
+
+    int mid = lo + (hi - lo) / 2;
+    NODE *root = _makeNode(dataArr[mid]);
+    if (root == NULL) {
+        *overflow = 1;
+        return NULL;
+    }
+
+    root->left = _build(dataArr, lo, mid - 1, overflow);
+    root->right = _build(dataArr, mid + 1, hi, overflow);
+
+    if (*overflow) {
+        _freeNodes(root);
+        return NULL;
+    }
+
+    root->height = max(getHeight(root->left), getHeight(root->right)) + 1;
+    return root;
+}
+
 // used in AVLT_Destroy
 static void _destroy( NODE *root, void (*callback)(void *))
 {
@@ -291,6 +329,50 @@ int AVLT_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *))
     return 1;
 }
 
+/* Builds a perfectly balanced tree from data sorted in ascending order (O(n))
+	return	1 success
+			0 overflow (or tree not empty)
+*/
+int AVLT_BuildFromSorted( TREE *pTree, void **dataArr, int n, void (*merge)(void *, void *))
+{
+    void **unique = dataArr; // data of the nodes (the first of equal keys)
+    int num = n;
+
+    if (pTree->root != NULL) return 0;
+
+    // duplicates are skipped in a separate buffer, so nothing is changed if the build fails
+    if (merge != NULL && n > 0) {
+        unique = (void **)malloc(sizeof(void *) * n);
+        if (unique == NULL) return 0;
+
+        num = 0;
+        unique[num++] = dataArr[0];
+        for (int i = 1; i < n; i++)
+            if (pTree->compare(unique[num - 1], dataArr[i]) != 0)
+                unique[num++] = dataArr[i];
+    }
+
+    int overflow = 0;
+    NODE *root = _build(unique, 0, num - 1, &overflow);
+    if (unique != dataArr) free(unique);
+    if (overflow) return 0;
+
+    // merges duplicates into the data kept in the tree
+    if (merge != NULL) {
+        int last = 0;
+        for (int i = 1; i < n; i++) {
+            if (pTree->compare(dataArr[last], dataArr[i]) == 0)
+                merge(dataArr[last], dataArr[i]);
+            else
+                last = i;
+        }
+    }
+
+    pTree->root = root;
+    pTree->count = num;
+    return 1;
+}
+
 /* Deletes a node with keyPtr from the tree
 	return	address of data of the node containing the key
 			NULL not found
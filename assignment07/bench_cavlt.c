@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc
+#include <string.h> // strdup, strcmp, strlen
+#include <time.h> // clock
+
+#include "avlt.h"
+#include "cavlt.h"
+
+// memory and lookup time of the pointer-based AVL tree (avlt.c) vs. the compact AVL tree (cavlt.c)
+
+#define REPEAT		10 // # of lookup passes over all words
+
+// User structure type definition
+// 단어 구조체
+typedef struct {
+	char	*word;		// 단어
+	int		freq;		// 빈도
+} tWord;
+
+static unsigned long string_bytes = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+tWord *createWord( char *word)
+{
+	tWord *newWord = malloc( sizeof( tWord));
+
+	if (newWord == NULL) return NULL;
+
+	newWord->word = strdup( word);
+	newWord->freq = 1;
+
+	return newWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void destroyWord( void *pWord)
+{
+	free( ((tWord *)pWord)->word);
+	free( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int compare_by_word( const void *n1, const void *n2)
+{
+	return strcmp( ((tWord *)n1)->word, ((tWord *)n2)->word);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void increase_freq(void *dataPtr)
+{
+	((tWord *)dataPtr)->freq++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// for AVLT_Traverse function
+void count_string_bytes(const void *dataPtr)
+{
+	string_bytes += strlen( ((tWord *)dataPtr)->word) + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	TREE *tree;
+	CTREE *ctree;
+	char word[100];
+	char **words; // 입력 단어 (중복 포함)
+	int num_words = 0;
+	int capacity = 1024;
+	long found = 0;
+	FILE *fp;
+	clock_t start;
+	double avlt_build, cavlt_build, avlt_search, cavlt_search;
+
+	if (argc != 2) {
+		fprintf( stderr, "usage: %s FILE\n", argv[0]);
+		return 1;
+	}
+
+	fp = fopen( argv[1], "rt");
+	if (!fp)
+	{
+		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
+		return 2;
+	}
+
+	words = malloc( sizeof( char *) * capacity);
+	while (fscanf( fp, "%99s", word) != EOF)
+	{
+		if (num_words == capacity)
+		{
+			capacity *= 2;
+			words = realloc( words, sizeof( char *) * capacity);
+		}
+		words[num_words++] = strdup( word);
+	}
+	fclose( fp);
+
+	// pointer-based AVL tree
+	tree = AVLT_Create( compare_by_word);
+	start = clock();
+	for (int i = 0; i < num_words; i++)
+	{
+		tWord *pWord = createWord( words[i]);
+
+		if (AVLT_Insert( tree, pWord, increase_freq) != 1) destroyWord( pWord);
+	}
+	avlt_build = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		for (int i = 0; i < num_words; i++)
+		{
+			tWord key = { words[i], 0 };
+			if (AVLT_Search( tree, &key) != NULL) found++;
+		}
+	}
+	avlt_search = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	// compact AVL tree
+	ctree = CAVLT_Create();
+	start = clock();
+	for (int i = 0; i < num_words; i++)
+		CAVLT_Insert( ctree, words[i]);
+	cavlt_build = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		for (int i = 0; i < num_words; i++)
+			if (CAVLT_Search( ctree, words[i]) != 0) found++;
+	}
+	cavlt_search = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	AVLT_Traverse( tree, count_string_bytes);
+
+	printf( "%d words (%d unique), height %d / %d, %ld found\n",
+		num_words, AVLT_Count( tree), AVLT_Height( tree), CAVLT_Height( ctree), found);
+	// malloc overhead (at least 8 bytes per block) is not counted for avlt
+	printf( "avlt : %lu bytes (NODE %zu + tWord %zu per word + strings), build %.3fs, %.1f ns/lookup\n",
+		AVLT_Count( tree) * (sizeof( NODE) + sizeof( tWord)) + string_bytes, sizeof( NODE), sizeof( tWord),
+		avlt_build, avlt_search * 1e9 / ((double)REPEAT * num_words));
+	printf( "cavlt: %lu bytes (CNODE %zu per word + string pool), build %.3fs, %.1f ns/lookup\n",
+		CAVLT_Memory( ctree), sizeof( CNODE),
+		cavlt_build, cavlt_search * 1e9 / ((double)REPEAT * num_words));
+
+	for (int i = 0; i < num_words; i++)
+		free( words[i]);
+	free( words);
+
+	AVLT_Destroy( tree, destroyWord);
+	CAVLT_Destroy( ctree);
+
+	return 0;
+}
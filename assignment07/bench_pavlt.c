@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, atoi
+#include <string.h> // strdup, strcmp
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h> // clock_gettime
+
+#include "pavlt.h"
+
+// read throughput of the persistent AVL tree
+// reader threads search random words lock-free while a single writer deletes and re-inserts words
+// and increases frequencies
+
+#define DURATION	1.0 // seconds per measurement
+
+// User structure type definition
+// 단어 구조체
+typedef struct {
+	char	*word;		// 단어
+	atomic_int	freq;		// 빈도 (reader가 동시에 읽음)
+} tWord;
+
+typedef struct {
+	int		id;
+	long	reads;
+	long	found;
+} tReader;
+
+static PTREE *tree;
+static char **dic; // 모든 단어
+static int num_words = 0;
+static atomic_int stop;
+
+////////////////////////////////////////////////////////////////////////////////
+tWord *createWord( char *word)
+{
+	tWord *newWord = malloc( sizeof( tWord));
+
+	if (newWord == NULL) return NULL;
+
+	newWord->word = strdup( word);
+	atomic_init( &newWord->freq, 1);
+
+	return newWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void destroyWord( void *pWord)
+{
+	free( ((tWord *)pWord)->word);
+	free( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int compare_by_word( const void *n1, const void *n2)
+{
+	return strcmp( ((tWord *)n1)->word, ((tWord *)n2)->word);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void increase_freq(void *dataPtr)
+{
+	atomic_fetch_add( &((tWord *)dataPtr)->freq, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static unsigned int next_rand( unsigned int *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return *seed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void *reader_main( void *arg)
+{
+	tReader *r = (tReader *)arg;
+	unsigned int seed = 2463534242u + r->id;
+	int reader = PAVLT_ReaderRegister( tree);
+	tWord key;
+
+	while (!atomic_load_explicit( &stop, memory_order_relaxed))
+	{
+		key.word = dic[next_rand( &seed) % num_words];
+
+		PAVLT_ReadLock( tree, reader);
+		tWord *pWord = PAVLT_Search( tree, &key);
+		if (pWord != NULL && atomic_load_explicit( &pWord->freq, memory_order_relaxed) > 0) r->found++;
+		PAVLT_ReadUnlock( tree, reader);
+
+		r->reads++;
+	}
+
+	PAVLT_ReaderUnregister( tree, reader);
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// runs num_readers reader threads and one writer (the calling thread) for DURATION seconds
+void measure( int num_readers)
+{
+	pthread_t threads[MAX_READERS];
+	tReader readers[MAX_READERS];
+	unsigned int seed = 88172645u;
+	long writes = 0;
+	long reads = 0;
+	double start;
+
+	atomic_store( &stop, 0);
+	for (int i = 0; i < num_readers; i++)
+	{
+		readers[i].id = i;
+		readers[i].reads = 0;
+		readers[i].found = 0;
+		pthread_create( &threads[i], NULL, reader_main, &readers[i]);
+	}
+
+	start = now();
+	while (now() - start < DURATION)
+	{
+		for (int i = 0; i < 100; i++, writes++)
+		{
+			tWord *pWord = createWord( dic[next_rand( &seed) % num_words]);
+
+			if (writes % 2 == 0)
+			{
+				// structural update: delete and re-insert
+				void *ptr = PAVLT_Delete( tree, pWord);
+				if (ptr != NULL) PAVLT_Retire( tree, ptr, destroyWord);
+			}
+			if (PAVLT_Insert( tree, pWord, increase_freq) != 1) destroyWord( pWord);
+		}
+	}
+	atomic_store( &stop, 1);
+
+	for (int i = 0; i < num_readers; i++)
+	{
+		pthread_join( threads[i], NULL);
+		reads += readers[i].reads;
+	}
+
+	printf( "%2d readers: %10.0f reads/s (%8.0f per reader), writer %8.0f ops/s\n",
+		num_readers, reads / DURATION, reads / DURATION / num_readers, writes / DURATION);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	char word[100];
+	int max_readers = 4;
+	int capacity = 1024;
+	FILE *fp;
+
+	if (argc != 2 && argc != 3)
+	{
+		fprintf( stderr, "usage: %s FILE [MAX_READERS]\n", argv[0]);
+		return 1;
+	}
+
+	if (argc == 3) max_readers = atoi( argv[2]);
+	if (max_readers < 1 || max_readers > MAX_READERS)
+	{
+		fprintf( stderr, "MAX_READERS should be 1 ~ %d\n", MAX_READERS);
+		return 1;
+	}
+
+	fp = fopen( argv[1], "rt");
+	if (!fp)
+	{
+		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
+		return 2;
+	}
+
+	tree = PAVLT_Create( compare_by_word);
+	dic = malloc( sizeof( char *) * capacity);
+
+	while (fscanf( fp, "%99s", word) != EOF)
+	{
+		tWord *pWord = createWord( word);
+
+		if (PAVLT_Insert( tree, pWord, increase_freq) != 1)
+		{
+			destroyWord( pWord);
+			continue;
+		}
+
+		if (num_words == capacity)
+		{
+			capacity *= 2;
+			dic = realloc( dic, sizeof( char *) * capacity);
+		}
+		dic[num_words++] = strdup( word);
+	}
+	fclose( fp);
+
+	printf( "%d words, height %d\n", PAVLT_Count( tree), PAVLT_Height( tree));
+
+	for (int n = 1; n <= max_readers; n *= 2)
+		measure( n);
+
+	for (int i = 0; i < num_words; i++)
+		free( dic[i]);
+	free( dic);
+
+	PAVLT_Destroy( tree, destroyWord);
+
+	return 0;
+}
@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc
+#include <string.h> // strdup, strcmp
+
+#include "avlt.h"
+
+// User structure type definition
+// 단어 구조체
+typedef struct {
+	char	*word;		// 단어
+	int		freq;		// 빈도
+} tWord;
+
+#define SAVLT_NAME	WT
+#define SAVLT_TYPE	tWord
+#define SAVLT_KEY	word
+#include "savlt.h"
+
+// per-lookup cycles of the AVL tree with a compare function pointer (avlt.c)
+// vs. the string-keyed AVL tree with inlined prefix comparison (savlt.h)
+
+#define REPEAT		10 // # of lookup passes over all words
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // __rdtsc
+#define CYCLES()	__rdtsc()
+#define UNIT		"cycles"
+#else
+#include <time.h> // clock_gettime
+static unsigned long long nsec(void)
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#define CYCLES()	nsec()
+#define UNIT		"ns"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+tWord *createWord( char *word)
+{
+	tWord *newWord = malloc( sizeof( tWord));
+
+	if (newWord == NULL) return NULL;
+
+	newWord->word = strdup( word);
+	newWord->freq = 1;
+
+	return newWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void destroyWord( void *pWord)
+{
+	free( ((tWord *)pWord)->word);
+	free( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// for WT_Destroy function
+void destroyWordT( tWord *pWord)
+{
+	destroyWord( pWord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int compare_by_word( const void *n1, const void *n2)
+{
+	return strcmp( ((tWord *)n1)->word, ((tWord *)n2)->word);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void increase_freq(void *dataPtr)
+{
+	((tWord *)dataPtr)->freq++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void increase_freqT(tWord *pWord)
+{
+	pWord->freq++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	TREE *tree;
+	WT_TREE *wtree;
+	char word[100];
+	char **words; // 입력 단어 (중복 포함)
+	int num_words = 0;
+	int capacity = 1024;
+	long found1 = 0, found2 = 0;
+	unsigned long long start, before, after;
+	FILE *fp;
+
+	if (argc != 2) {
+		fprintf( stderr, "usage: %s FILE\n", argv[0]);
+		return 1;
+	}
+
+	fp = fopen( argv[1], "rt");
+	if (!fp)
+	{
+		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
+		return 2;
+	}
+
+	words = malloc( sizeof( char *) * capacity);
+	while (fscanf( fp, "%99s", word) != EOF)
+	{
+		if (num_words == capacity)
+		{
+			capacity *= 2;
+			words = realloc( words, sizeof( char *) * capacity);
+		}
+		words[num_words++] = strdup( word);
+	}
+	fclose( fp);
+
+	tree = AVLT_Create( compare_by_word);
+	wtree = WT_Create();
+	for (int i = 0; i < num_words; i++)
+	{
+		tWord *pWord = createWord( words[i]);
+		if (AVLT_Insert( tree, pWord, increase_freq) != 1) destroyWord( pWord);
+
+		pWord = createWord( words[i]);
+		if (WT_Insert( wtree, pWord, increase_freqT) != 1) destroyWord( pWord);
+	}
+
+	// before: compare through function pointer
+	start = CYCLES();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		for (int i = 0; i < num_words; i++)
+		{
+			tWord key = { words[i], 0 };
+			if (AVLT_Search( tree, &key) != NULL) found1++;
+		}
+	}
+	before = CYCLES() - start;
+
+	// after: inlined prefix comparison
+	start = CYCLES();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		for (int i = 0; i < num_words; i++)
+			if (WT_Search( wtree, words[i]) != NULL) found2++;
+	}
+	after = CYCLES() - start;
+
+	printf( "%d lookups x %d, height %d / %d, found %ld / %ld\n",
+		num_words, REPEAT, AVLT_Height( tree), WT_Height( wtree), found1, found2);
+	printf( "avlt  (compare function): %.1f %s/lookup\n", (double)before / ((double)REPEAT * num_words), UNIT);
+	printf( "savlt (inlined prefix)  : %.1f %s/lookup\n", (double)after / ((double)REPEAT * num_words), UNIT);
+
+	for (int i = 0; i < num_words; i++)
+		free( words[i]);
+	free( words);
+
+	AVLT_Destroy( tree, destroyWord);
+	WT_Destroy( wtree, destroyWordT);
+
+	return 0;
+}
@@ -0,0 +1,340 @@
+#include <stdlib.h> // malloc, realloc
+#include <string.h> // strcmp, strlen, memcpy
+
+#include "cavlt.h"
+
+#define max(x, y)	(((x) > (y)) ? (x) : (y))
+
+#define LEFT(t, i)		((t)->nodes[i].left & INDEX_MASK)
+#define RIGHT(t, i)		((t)->nodes[i].right)
+#define KEY(t, i)		((t)->pool + (t)->nodes[i].key)
+
+// internal functions (not mandatory)
+
+// internal function
+// return	height of the (sub)tree from the node (root); -1 for NIL
+static int getHeight( CTREE *pTree, unsigned int root)
+{
+    return (int)(pTree->nodes[root].left >> INDEX_BITS) - 1;
+}
+
+// internal function
+static void setLeft( CTREE *pTree, unsigned int root, unsigned int left)
+{
+    pTree->nodes[root].left = (pTree->nodes[root].left & ~INDEX_MASK) | left;
+}
+
+// internal function
+// updates height of the node from its children
+static void fixHeight( CTREE *pTree, unsigned int root)
+{
+    int h = max(getHeight(pTree, LEFT(pTree, root)), getHeight(pTree, RIGHT(pTree, root))) + 1;
+    pTree->nodes[root].left = LEFT(pTree, root) | ((unsigned int)(h + 1) << INDEX_BITS);
+}
+
+// internal function
+// Exchanges indices to rotate the tree to the right
+// updates heights of the nodes
+// return	new root
+static unsigned int rotateRight( CTREE *pTree, unsigned int root)
+{
+    unsigned int newroot = LEFT(pTree, root);
+    setLeft(pTree, root, RIGHT(pTree, newroot));
+    RIGHT(pTree, newroot) = root;
+
+    fixHeight(pTree, root);
+    fixHeight(pTree, newroot);
+
+    return newroot;
+}
+
+// internal function
+// Exchanges indices to rotate the tree to the left
+// updates heights of the nodes
+// return	new root
+static unsigned int rotateLeft( CTREE *pTree, unsigned int root)
+{
+    unsigned int newroot = RIGHT(pTree, root);
+    RIGHT(pTree, root) = LEFT(pTree, newroot);
+    setLeft(pTree, newroot, root);
+
+    fixHeight(pTree, root);
+    fixHeight(pTree, newroot);
+
+    return newroot;
+}
+
+// used in _insert and _delete
+// fixes height and balancing with rotation
+// return	new root
+static unsigned int _balance( CTREE *pTree, unsigned int root)
+{
+    unsigned int left = LEFT(pTree, root);
+    unsigned int right = RIGHT(pTree, root);
+
+    // if unbalanced, leftbalance
+    if (getHeight(pTree, left) > getHeight(pTree, right) + 1) {
+        // LR situation
+        if (getHeight(pTree, LEFT(pTree, left)) < getHeight(pTree, RIGHT(pTree, left)))
+            setLeft(pTree, root, rotateLeft(pTree, left));
+        // LL situation
+        return rotateRight(pTree, root);
+    }
+    // else if unbalanced, rightbalance
+    else if (getHeight(pTree, right) > getHeight(pTree, left) + 1) {
+        // RL situation
+        if (getHeight(pTree, RIGHT(pTree, right)) < getHeight(pTree, LEFT(pTree, right)))
+            RIGHT(pTree, root) = rotateRight(pTree, right);
+        // RR situation
+        return rotateLeft(pTree, root);
+    }
+
+    fixHeight(pTree, root);
+    return root;
+}
+
+// used in _insert
+// allocates a node and copies the word into the string pool
+// return	index of the new node
+//			NIL if overflow
+static unsigned int _makeNode( CTREE *pTree, const char *word)
+{
+    unsigned int len = strlen(word) + 1;
+    unsigned int newnode;
+
+    if (pTree->poolSize + len > pTree->poolCap) {
+        unsigned int newCap = max(pTree->poolCap * 2, pTree->poolSize + len);
+        char *newPool = realloc(pTree->pool, newCap);
+        if (newPool == NULL) return NIL;
+
+        pTree->pool = newPool;
+        pTree->poolCap = newCap;
+    }
+
+    if (pTree->freeList != NIL) {
+        newnode = pTree->freeList;
+        pTree->freeList = RIGHT(pTree, newnode);
+    }
+    else {
+        if (pTree->numNodes > INDEX_MASK) return NIL;
+
+        if (pTree->numNodes == pTree->capNodes) {
+            CNODE *newNodes = realloc(pTree->nodes, sizeof(CNODE) * pTree->capNodes * 2);
+            if (newNodes == NULL) return NIL;
+
+            pTree->nodes = newNodes;
+            pTree->capNodes *= 2;
+        }
+        newnode = pTree->numNodes++;
+    }
+
+    memcpy(pTree->pool + pTree->poolSize, word, len);
+    pTree->nodes[newnode].key = pTree->poolSize;
+    pTree->nodes[newnode].left = NIL | (1u << INDEX_BITS); // height 0
+    pTree->nodes[newnode].right = NIL;
+    pTree->nodes[newnode].freq = 1;
+    pTree->poolSize += len;
+
+    return newnode;
+}
+
+// used in CAVLT_Delete
+// puts the node into the free list
+static void _freeNode( CTREE *pTree, unsigned int node)
+{
+    RIGHT(pTree, node) = pTree->freeList;
+    pTree->freeList = node;
+}
+
+// used in CAVLT_Insert
+// return 	index of root
+//			*result: 1 success, 0 overflow, 2 duplicated
+static unsigned int _insert( CTREE *pTree, unsigned int root, const char *word, int *result)
+{
+    if (root == NIL) {
+        unsigned int newnode = _makeNode(pTree, word);
+        *result = (newnode != NIL);
+        return newnode;
+    }
+
+    int cmp = strcmp(word, KEY(pTree, root));
+
+    if (cmp == 0) {
+        pTree->nodes[root].freq++;
+        *result = 2;
+        return root;
+    }
+
+    // nodes may be reallocated in the recursive call; only indices are kept
+    if (cmp < 0) {
+        unsigned int child = _insert(pTree, LEFT(pTree, root), word, result);
+        if (*result != 1) return root;
+        setLeft(pTree, root, child);
+    }
+    else {
+        unsigned int child = _insert(pTree, RIGHT(pTree, root), word, result);
+        if (*result != 1) return root;
+        RIGHT(pTree, root) = child;
+    }
+
+    return _balance(pTree, root);
+}
+
+// used in CAVLT_Delete
+// return 	index of root
+static unsigned int _delete( CTREE *pTree, unsigned int root, const char *word, int *freqOut)
+{
+    if (root == NIL) return NIL;
+
+    int cmp = strcmp(word, KEY(pTree, root));
+
+    if (cmp < 0) {
+        setLeft(pTree, root, _delete(pTree, LEFT(pTree, root), word, freqOut));
+    }
+    else if (cmp > 0) {
+        RIGHT(pTree, root) = _delete(pTree, RIGHT(pTree, root), word, freqOut);
+    }
+    else {
+        if (*freqOut == 0) *freqOut = pTree->nodes[root].freq;
+
+        if (LEFT(pTree, root) == NIL || RIGHT(pTree, root) == NIL) {
+            unsigned int child = (LEFT(pTree, root) == NIL) ? RIGHT(pTree, root) : LEFT(pTree, root);
+            _freeNode(pTree, root);
+            return child;
+        }
+
+        // replaces the key with its successor and deletes the successor
+        unsigned int pLoc = RIGHT(pTree, root);
+        while (LEFT(pTree, pLoc) != NIL) pLoc = LEFT(pTree, pLoc);
+
+        pTree->nodes[root].key = pTree->nodes[pLoc].key;
+        pTree->nodes[root].freq = pTree->nodes[pLoc].freq;
+
+        int dummy = -1; // keeps *freqOut of the deleted word
+        RIGHT(pTree, root) = _delete(pTree, RIGHT(pTree, root), KEY(pTree, root), &dummy);
+    }
+
+    return _balance(pTree, root);
+}
+
+// used in CAVLT_Traverse
+static void _traverse( CTREE *pTree, unsigned int root, void (*callback)(const char *, int))
+{
+    if (root == NIL) return;
+
+    _traverse(pTree, LEFT(pTree, root), callback);
+    callback(KEY(pTree, root), pTree->nodes[root].freq);
+    _traverse(pTree, RIGHT(pTree, root), callback);
+}
+
+// used in CAVLT_TraverseR
+static void _traverseR( CTREE *pTree, unsigned int root, void (*callback)(const char *, int))
+{
+    if (root == NIL) return;
+
+    _traverseR(pTree, RIGHT(pTree, root), callback);
+    callback(KEY(pTree, root), pTree->nodes[root].freq);
+    _traverseR(pTree, LEFT(pTree, root), callback);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// cavlt.h function declarations
+
+CTREE *CAVLT_Create( void)
+{
+    CTREE *newtree = (CTREE*)malloc(sizeof(CTREE));
+    if (newtree == NULL) return NULL;
+
+    newtree->capNodes = 1024;
+    newtree->nodes = (CNODE*)malloc(sizeof(CNODE) * newtree->capNodes);
+    newtree->poolCap = 8192;
+    newtree->pool = (char*)malloc(newtree->poolCap);
+
+    if (newtree->nodes == NULL || newtree->pool == NULL) {
+        free(newtree->nodes);
+        free(newtree->pool);
+        free(newtree);
+        return NULL;
+    }
+
+    // sentinel
+    newtree->nodes[NIL].key = 0;
+    newtree->nodes[NIL].left = NIL; // height -1
+    newtree->nodes[NIL].right = NIL;
+    newtree->nodes[NIL].freq = 0;
+    newtree->numNodes = 1;
+
+    newtree->count = 0;
+    newtree->root = NIL;
+    newtree->freeList = NIL;
+    newtree->poolSize = 0;
+
+    return newtree;
+}
+
+void CAVLT_Destroy( CTREE *pTree)
+{
+    free(pTree->nodes);
+    free(pTree->pool);
+    free(pTree);
+}
+
+int CAVLT_Insert( CTREE *pTree, const char *word)
+{
+    int result = 0;
+
+    pTree->root = _insert(pTree, pTree->root, word, &result);
+    if (result == 1) pTree->count++;
+
+    return result;
+}
+
+int CAVLT_Delete( CTREE *pTree, const char *word)
+{
+    int freq = 0;
+
+    pTree->root = _delete(pTree, pTree->root, word, &freq);
+    if (freq != 0) pTree->count--;
+
+    return freq;
+}
+
+int CAVLT_Search( CTREE *pTree, const char *word)
+{
+    unsigned int root = pTree->root;
+
+    while (root != NIL) {
+        int cmp = strcmp(word, KEY(pTree, root));
+
+        if (cmp < 0) root = LEFT(pTree, root);
+        else if (cmp > 0) root = RIGHT(pTree, root);
+        else return pTree->nodes[root].freq;
+    }
+    return 0;
+}
+
+void CAVLT_Traverse( CTREE *pTree, void (*callback)(const char *word, int freq))
+{
+    _traverse(pTree, pTree->root, callback);
+}
+
+void CAVLT_TraverseR( CTREE *pTree, void (*callback)(const char *word, int freq))
+{
+    _traverseR(pTree, pTree->root, callback);
+}
+
+int CAVLT_Count( CTREE *pTree)
+{
+    return pTree->count;
+}
+
+int CAVLT_Height( CTREE *pTree)
+{
+    return getHeight(pTree, pTree->root);
+}
+
+unsigned long CAVLT_Memory( CTREE *pTree)
+{
+    return (unsigned long)pTree->capNodes * sizeof(CNODE) + pTree->poolCap;
+}
@@ -0,0 +1,84 @@
+// compact AVL tree for word counting
+// nodes live in one contiguous array and refer to each other by 32-bit indices;
+// words are copied into a string pool owned by the tree and the frequency is stored in the node
+
+#define INDEX_BITS	26 // max # of nodes = 2^26 - 1
+#define INDEX_MASK	((1u << INDEX_BITS) - 1)
+#define NIL			0 // nodes[0] is a sentinel (height -1)
+
+////////////////////////////////////////////////////////////////////////////////
+// CTREE type definition
+typedef struct
+{
+	unsigned int	key; // offset of the word in the string pool
+	unsigned int	left; // index of left child (lower INDEX_BITS bits) | height + 1 (upper bits)
+	unsigned int	right; // index of right child (next free node if the node is free)
+	int 	freq;
+} CNODE;
+
+typedef struct
+{
+	int 	count;
+	unsigned int	root;
+	CNODE	*nodes;
+	unsigned int	numNodes; // # of used slots in nodes (including the sentinel)
+	unsigned int	capNodes;
+	unsigned int	freeList; // list of deleted nodes (linked by right)
+	char	*pool; // string pool
+	unsigned int	poolSize;
+	unsigned int	poolCap;
+} CTREE;
+
+////////////////////////////////////////////////////////////////////////////////
+// Prototype declarations
+
+/* Allocates dynamic memory for a tree head node and returns its address to caller
+	return	head node pointer
+			NULL if overflow
+*/
+CTREE *CAVLT_Create( void);
+
+/* Deletes all data in tree and recycles memory
+*/
+void CAVLT_Destroy( CTREE *pTree);
+
+/* Inserts a word into the tree (copied into the string pool)
+	이미 트리에 존재하는 단어이면 빈도를 증가시킴
+	return	1 success
+			0 overflow
+			2 if duplicated key
+*/
+int CAVLT_Insert( CTREE *pTree, const char *word);
+
+/* Deletes a node with word from the tree
+	the space of the word in the string pool is not recycled
+	return	frequency of the deleted word
+			0 not found
+*/
+int CAVLT_Delete( CTREE *pTree, const char *word);
+
+/* Retrieve tree for the node containing the requested word
+	return	frequency of the word
+			0 not found
+*/
+int CAVLT_Search( CTREE *pTree, const char *word);
+
+/* prints tree using inorder traversal
+*/
+void CAVLT_Traverse( CTREE *pTree, void (*callback)(const char *word, int freq));
+
+/* prints tree using right-to-left inorder traversal
+*/
+void CAVLT_TraverseR( CTREE *pTree, void (*callback)(const char *word, int freq));
+
+/* returns number of nodes in tree
+*/
+int CAVLT_Count( CTREE *pTree);
+
+/* returns height of the tree
+*/
+int CAVLT_Height( CTREE *pTree);
+
+/* returns bytes allocated for the tree (node array + string pool)
+*/
+unsigned long CAVLT_Memory( CTREE *pTree);
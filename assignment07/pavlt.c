@@ -0,0 +1,523 @@
+#include <stdlib.h> // malloc, realloc
+#include <sched.h> // sched_yield
+
+#include "pavlt.h"
+
+#define max(x, y)	(((x) > (y)) ? (x) : (y))
+
+// internal functions (not mandatory)
+
+// internal function
+// return	height of the (sub)tree from the node (root)
+static int getHeight( PNODE *root)
+{
+    if (root == NULL)
+        return -1;
+    else
+        return root->height;
+}
+
+// internal function
+// appends ptr to pointer array (*arr), doubling the capacity if full
+// return	1 success
+//			0 overflow
+static int _push( PNODE ***arr, int *num, int *cap, PNODE *ptr)
+{
+    if (*num >= *cap) {
+        int newCap = (*cap == 0) ? 16 : *cap * 2;
+        PNODE **newArr = realloc(*arr, sizeof(PNODE *) * newCap);
+        if (newArr == NULL) return 0;
+
+        *arr = newArr;
+        *cap = newCap;
+    }
+    (*arr)[(*num)++] = ptr;
+    return 1;
+}
+
+// internal function
+// makes sure that n more objects can be retired without allocation
+// return	1 success
+//			0 overflow
+static int _reserveRetired( PTREE *pTree, int n)
+{
+    if (pTree->numRetired + n <= pTree->capRetired) return 1;
+
+    int newCap = max(pTree->capRetired * 2, pTree->numRetired + n);
+    RETIRED *newArr = realloc(pTree->retired, sizeof(RETIRED) * newCap);
+    if (newArr == NULL) return 0;
+
+    pTree->retired = newArr;
+    pTree->capRetired = newCap;
+    return 1;
+}
+
+// used in write operations
+// allocates a node for the current write operation
+// return	new node
+//			NULL if overflow (pTree->overflow is set)
+static PNODE *_makeNode( PTREE *pTree, void *dataInPtr, PNODE *left, PNODE *right)
+{
+    PNODE *newnode = (PNODE*)malloc(sizeof(PNODE));
+    if (newnode == NULL) {
+        pTree->overflow = 1;
+        return NULL;
+    }
+
+    if (!_push(&pTree->fresh, &pTree->numFresh, &pTree->capFresh, newnode)) {
+        free(newnode);
+        pTree->overflow = 1;
+        return NULL;
+    }
+
+    newnode->dataPtr = dataInPtr;
+    newnode->left = left;
+    newnode->right = right;
+    newnode->height = max(getHeight(left), getHeight(right)) + 1;
+    newnode->version = pTree->version;
+
+    return newnode;
+}
+
+// used in write operations
+// marks a published node as replaced (it is retired when the operation commits)
+static void _replace( PTREE *pTree, PNODE *node)
+{
+    if (!_push(&pTree->replaced, &pTree->numReplaced, &pTree->capReplaced, node))
+        pTree->overflow = 1;
+}
+
+// used in write operations
+// returns a node which can be modified in the current write operation
+// published nodes are copied (path copying); nodes created in this operation are returned as they are
+// return	writable node
+//			the node itself if overflow (pTree->overflow is set; the node must not be modified)
+static PNODE *_own( PTREE *pTree, PNODE *node)
+{
+    if (node == NULL || node->version == pTree->version) return node;
+
+    PNODE *copy = _makeNode(pTree, node->dataPtr, node->left, node->right);
+    if (copy == NULL) return node;
+
+    _replace(pTree, node);
+    return copy;
+}
+
+// internal function
+// updates height of a writable node
+static void _fixHeight( PNODE *root)
+{
+    root->height = max(getHeight(root->left), getHeight(root->right)) + 1;
+}
+
+// internal function
+// Exchanges pointers to rotate the (writable) tree to the right
+// the left child is copied if it is published
+// return	new root
+static PNODE *rotateRight( PTREE *pTree, PNODE *root)
+{
+    PNODE *newroot = _own(pTree, root->left);
+    if (pTree->overflow) return root;
+
+    root->left = newroot->right;
+    newroot->right = root;
+
+    _fixHeight(root);
+    _fixHeight(newroot);
+
+    return newroot;
+}
+
+// internal function
+// Exchanges pointers to rotate the (writable) tree to the left
+// the right child is copied if it is published
+// return	new root
+static PNODE *rotateLeft( PTREE *pTree, PNODE *root)
+{
+    PNODE *newroot = _own(pTree, root->right);
+    if (pTree->overflow) return root;
+
+    root->right = newroot->left;
+    newroot->left = root;
+
+    _fixHeight(root);
+    _fixHeight(newroot);
+
+    return newroot;
+}
+
+// used in _insert, _delete and _deleteMin
+// fixes height and balancing of the (writable) tree with rotation
+// return	new root
+static PNODE *_balance( PTREE *pTree, PNODE *root)
+{
+    // if unbalanced, leftbalance
+    if (getHeight(root->left) > getHeight(root->right) + 1) {
+        // LR situation
+        if (getHeight(root->left->left) < getHeight(root->left->right)) {
+            root->left = _own(pTree, root->left);
+            if (pTree->overflow) return root;
+            root->left = rotateLeft(pTree, root->left);
+            if (pTree->overflow) return root;
+        }
+        // LL situation
+        return rotateRight(pTree, root);
+    }
+    // else if unbalanced, rightbalance
+    else if (getHeight(root->right) > getHeight(root->left) + 1) {
+        // RL situation
+        if (getHeight(root->right->right) < getHeight(root->right->left)) {
+            root->right = _own(pTree, root->right);
+            if (pTree->overflow) return root;
+            root->right = rotateRight(pTree, root->right);
+            if (pTree->overflow) return root;
+        }
+        // RR situation
+        return rotateLeft(pTree, root);
+    }
+
+    _fixHeight(root);
+    return root;
+}
+
+// used in PAVLT_Insert
+// return 	pointer to root of the new version
+static PNODE *_insert( PTREE *pTree, PNODE *root, void *dataInPtr, void (*callback)(void *), int *duplicated)
+{
+    if (root == NULL) {
+        return _makeNode(pTree, dataInPtr, NULL, NULL);
+    }
+
+    int cmp = pTree->compare(dataInPtr, root->dataPtr);
+
+    if (cmp == 0) {
+        callback(root->dataPtr);
+        *duplicated = 1;
+        return root;
+    }
+
+    PNODE *child = _insert(pTree, (cmp < 0) ? root->left : root->right, dataInPtr, callback, duplicated);
+    if (pTree->overflow || *duplicated) return root;
+
+    PNODE *newroot = _own(pTree, root);
+    if (pTree->overflow) return root;
+
+    if (cmp < 0) newroot->left = child;
+    else newroot->right = child;
+
+    return _balance(pTree, newroot);
+}
+
+// used in _delete
+// removes the leftmost node from the tree
+// return 	pointer to root of the new version
+static PNODE *_deleteMin( PTREE *pTree, PNODE *root, void **minDataPtr)
+{
+    if (root->left == NULL) {
+        *minDataPtr = root->dataPtr;
+        _replace(pTree, root);
+        return root->right;
+    }
+
+    PNODE *child = _deleteMin(pTree, root->left, minDataPtr);
+    if (pTree->overflow) return root;
+
+    PNODE *newroot = _own(pTree, root);
+    if (pTree->overflow) return root;
+
+    newroot->left = child;
+    return _balance(pTree, newroot);
+}
+
+// used in PAVLT_Delete
+// return 	pointer to root of the new version
+static PNODE *_delete( PTREE *pTree, PNODE *root, void *keyPtr, void **dataOutPtr)
+{
+    if (root == NULL) return NULL;
+
+    int cmp = pTree->compare(keyPtr, root->dataPtr);
+
+    if (cmp == 0) {
+        *dataOutPtr = root->dataPtr;
+
+        if (root->left == NULL || root->right == NULL) {
+            _replace(pTree, root);
+            return (root->left == NULL) ? root->right : root->left;
+        }
+
+        void *minDataPtr;
+        PNODE *right = _deleteMin(pTree, root->right, &minDataPtr);
+        if (pTree->overflow) return root;
+
+        PNODE *newroot = _own(pTree, root);
+        if (pTree->overflow) return root;
+
+        newroot->dataPtr = minDataPtr;
+        newroot->right = right;
+        return _balance(pTree, newroot);
+    }
+
+    PNODE *child = _delete(pTree, (cmp < 0) ? root->left : root->right, keyPtr, dataOutPtr);
+    if (pTree->overflow || *dataOutPtr == NULL) return root;
+
+    PNODE *newroot = _own(pTree, root);
+    if (pTree->overflow) return root;
+
+    if (cmp < 0) newroot->left = child;
+    else newroot->right = child;
+
+    return _balance(pTree, newroot);
+}
+
+// used in write operations
+// starts a new version of the tree
+static void _begin( PTREE *pTree)
+{
+    pTree->version++;
+    pTree->overflow = 0;
+    pTree->numFresh = 0;
+    pTree->numReplaced = 0;
+}
+
+// used in write operations
+// publishes new root and retires the replaced nodes
+// return	1 success
+//			0 overflow (the new version is discarded)
+static int _commit( PTREE *pTree, PNODE *newroot)
+{
+    if (pTree->overflow || !_reserveRetired(pTree, pTree->numReplaced)) {
+        // discard the new version
+        for (int i = 0; i < pTree->numFresh; i++)
+            free(pTree->fresh[i]);
+        pTree->numFresh = 0;
+        pTree->numReplaced = 0;
+        return 0;
+    }
+
+    atomic_store(&pTree->root, newroot);
+
+    // readers which have entered after this point cannot see the replaced nodes
+    unsigned long epoch = atomic_fetch_add(&pTree->epoch, 1);
+    for (int i = 0; i < pTree->numReplaced; i++) {
+        RETIRED *r = &pTree->retired[pTree->numRetired++];
+        r->ptr = pTree->replaced[i];
+        r->callback = NULL;
+        r->epoch = epoch;
+    }
+    pTree->numFresh = 0;
+    pTree->numReplaced = 0;
+
+    if (pTree->numRetired >= RECLAIM_THRESHOLD) PAVLT_Reclaim(pTree);
+
+    return 1;
+}
+
+// used in PAVLT_Reclaim and PAVLT_Destroy
+static void _free_retired( RETIRED *r)
+{
+    if (r->callback == NULL) free(r->ptr);
+    else r->callback(r->ptr);
+}
+
+// used in PAVLT_Destroy
+static void _destroy( PNODE *root, void (*callback)(void *))
+{
+    if (root == NULL) return;
+
+    _destroy(root->left, callback);
+    _destroy(root->right, callback);
+
+    callback(root->dataPtr);
+    free(root);
+}
+
+// used in PAVLT_Traverse
+static void _traverse( PNODE *root, void (*callback)(const void *))
+{
+    if (root == NULL) return;
+
+    _traverse(root->left, callback);
+    callback(root->dataPtr);
+    _traverse(root->right, callback);
+}
+
+// used in PAVLT_TraverseR
+static void _traverseR( PNODE *root, void (*callback)(const void *))
+{
+    if (root == NULL) return;
+
+    _traverseR(root->right, callback);
+    callback(root->dataPtr);
+    _traverseR(root->left, callback);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// pavlt.h function declarations
+
+PTREE *PAVLT_Create( int (*compare)(const void *, const void *))
+{
+    PTREE *newtree = (PTREE*)calloc(1, sizeof(PTREE));
+    if (newtree == NULL) return NULL;
+
+    newtree->compare = compare;
+    atomic_init(&newtree->root, NULL);
+    atomic_init(&newtree->count, 0);
+    atomic_init(&newtree->epoch, 1);
+    for (int i = 0; i < MAX_READERS; i++) {
+        atomic_init(&newtree->readerEpoch[i], 0);
+        atomic_init(&newtree->readerUsed[i], 0);
+    }
+
+    return newtree;
+}
+
+void PAVLT_Destroy( PTREE *pTree, void (*callback)(void *))
+{
+    _destroy(atomic_load(&pTree->root), callback);
+
+    for (int i = 0; i < pTree->numRetired; i++)
+        _free_retired(&pTree->retired[i]);
+
+    free(pTree->fresh);
+    free(pTree->replaced);
+    free(pTree->retired);
+    free(pTree);
+}
+
+int PAVLT_Insert( PTREE *pTree, void *dataInPtr, void (*callback)(void *))
+{
+    int dup = 0;
+
+    _begin(pTree);
+    PNODE *newroot = _insert(pTree, atomic_load(&pTree->root), dataInPtr, callback, &dup);
+
+    if (dup == 1) return 2;
+    if (!_commit(pTree, newroot)) return 0;
+
+    atomic_fetch_add(&pTree->count, 1);
+    return 1;
+}
+
+void *PAVLT_Delete( PTREE *pTree, void *keyPtr)
+{
+    void *gom = NULL;
+
+    _begin(pTree);
+    PNODE *newroot = _delete(pTree, atomic_load(&pTree->root), keyPtr, &gom);
+
+    if (gom == NULL) return NULL;
+    if (!_commit(pTree, newroot)) return NULL;
+
+    atomic_fetch_sub(&pTree->count, 1);
+    return gom;
+}
+
+void PAVLT_Retire( PTREE *pTree, void *ptr, void (*callback)(void *))
+{
+    if (!_reserveRetired(pTree, 1)) {
+        // cannot defer: waits for the readers instead
+        PAVLT_Synchronize(pTree);
+        callback(ptr);
+        return;
+    }
+
+    RETIRED *r = &pTree->retired[pTree->numRetired++];
+    r->ptr = ptr;
+    r->callback = callback;
+    r->epoch = atomic_fetch_add(&pTree->epoch, 1);
+
+    if (pTree->numRetired >= RECLAIM_THRESHOLD) PAVLT_Reclaim(pTree);
+}
+
+void PAVLT_Reclaim( PTREE *pTree)
+{
+    // the oldest epoch in which a reader may still be
+    unsigned long oldest = atomic_load(&pTree->epoch);
+    for (int i = 0; i < MAX_READERS; i++) {
+        unsigned long e = atomic_load(&pTree->readerEpoch[i]);
+        if (e != 0 && e < oldest) oldest = e;
+    }
+
+    int last = 0;
+    for (int i = 0; i < pTree->numRetired; i++) {
+        if (pTree->retired[i].epoch < oldest)
+            _free_retired(&pTree->retired[i]);
+        else
+            pTree->retired[last++] = pTree->retired[i];
+    }
+    pTree->numRetired = last;
+}
+
+void PAVLT_Synchronize( PTREE *pTree)
+{
+    unsigned long epoch = atomic_fetch_add(&pTree->epoch, 1);
+
+    for (int i = 0; i < MAX_READERS; i++) {
+        unsigned long e;
+        while ((e = atomic_load(&pTree->readerEpoch[i])) != 0 && e <= epoch)
+            sched_yield();
+    }
+}
+
+int PAVLT_ReaderRegister( PTREE *pTree)
+{
+    for (int i = 0; i < MAX_READERS; i++) {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&pTree->readerUsed[i], &expected, 1))
+            return i;
+    }
+    return -1;
+}
+
+void PAVLT_ReaderUnregister( PTREE *pTree, int reader)
+{
+    atomic_store(&pTree->readerEpoch[reader], 0);
+    atomic_store(&pTree->readerUsed[reader], 0);
+}
+
+void PAVLT_ReadLock( PTREE *pTree, int reader)
+{
+    atomic_store(&pTree->readerEpoch[reader], atomic_load(&pTree->epoch));
+}
+
+void PAVLT_ReadUnlock( PTREE *pTree, int reader)
+{
+    atomic_store(&pTree->readerEpoch[reader], 0);
+}
+
+void *PAVLT_Search( PTREE *pTree, void *keyPtr)
+{
+    PNODE *root = atomic_load(&pTree->root);
+
+    while (root != NULL) {
+        int cmp = pTree->compare(keyPtr, root->dataPtr);
+
+        if (cmp < 0) root = root->left;
+        else if (cmp > 0) root = root->right;
+        else return root->dataPtr;
+    }
+    return NULL;
+}
+
+void PAVLT_Traverse( PTREE *pTree, void (*callback)(const void *))
+{
+    _traverse(atomic_load(&pTree->root), callback);
+}
+
+void PAVLT_TraverseR( PTREE *pTree, void (*callback)(const void *))
+{
+    _traverseR(atomic_load(&pTree->root), callback);
+}
+
+int PAVLT_Count( PTREE *pTree)
+{
+    return atomic_load(&pTree->count);
+}
+
+int PAVLT_Height( PTREE *pTree)
+{
+    PNODE *root = atomic_load(&pTree->root);
+    if (root == NULL) return -1;
+    return root->height;
+}
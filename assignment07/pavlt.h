@@ -0,0 +1,134 @@
+#include <stdatomic.h>
+
+// persistent (path-copying) AVL tree
+// a single writer builds new versions of the tree and publishes the new root atomically;
+// readers traverse an immutable snapshot without locks.
+// replaced nodes are reclaimed later when no reader can still see them (epoch-based reclamation)
+
+#define MAX_READERS			64
+#define RECLAIM_THRESHOLD	1024 // # of retired objects which triggers reclamation
+
+////////////////////////////////////////////////////////////////////////////////
+// PTREE type definition
+typedef struct pnode
+{
+	void 	*dataPtr;
+	struct pnode	*left;
+	struct pnode	*right;
+	int 	height;
+	unsigned long	version; // write operation that created this node (never modified after publication)
+} PNODE;
+
+// object waiting for reclamation
+typedef struct
+{
+	void 	*ptr;
+	void 	(*callback)(void *); // NULL for tree node
+	unsigned long	epoch;
+} RETIRED;
+
+typedef struct
+{
+	_Atomic(PNODE *)	root;
+	atomic_int 	count;
+	int 	(*compare)(const void *, const void *);
+
+	// used by the writer only
+	unsigned long	version;
+	int 	overflow;
+	PNODE	**fresh; // nodes created in the current write operation
+	int 	numFresh, capFresh;
+	PNODE	**replaced; // published nodes replaced in the current write operation
+	int 	numReplaced, capReplaced;
+	RETIRED	*retired;
+	int 	numRetired, capRetired;
+
+	// epoch-based reclamation
+	atomic_ulong	epoch;
+	atomic_ulong	readerEpoch[MAX_READERS]; // 0 if the reader is not in a read-side section
+	atomic_int 	readerUsed[MAX_READERS];
+} PTREE;
+
+////////////////////////////////////////////////////////////////////////////////
+// Prototype declarations
+
+/* Allocates dynamic memory for a tree head node and returns its address to caller
+	return	head node pointer
+			NULL if overflow
+*/
+PTREE *PAVLT_Create( int (*compare)(const void *, const void *));
+
+/* Deletes all data in tree and recycles memory (including retired objects)
+	no reader should be active
+*/
+void PAVLT_Destroy( PTREE *pTree, void (*callback)(void *));
+
+/* Inserts new data into the tree (writer only)
+	callback은 이미 트리에 존재하는 데이터를 발견했을 때 호출하는 함수
+	(reader가 같은 데이터를 동시에 읽을 수 있으므로 atomic하게 갱신해야 함)
+	return	1 success
+			0 overflow (the tree is not changed)
+			2 if duplicated key
+*/
+int PAVLT_Insert( PTREE *pTree, void *dataInPtr, void (*callback)(void *));
+
+/* Deletes a node with keyPtr from the tree (writer only)
+	readers may still see the returned data; it should be released with PAVLT_Retire
+	return	address of data of the node containing the key
+			NULL not found (or overflow)
+*/
+void *PAVLT_Delete( PTREE *pTree, void *keyPtr);
+
+/* Defers callback(ptr) until no reader can see ptr (writer only)
+*/
+void PAVLT_Retire( PTREE *pTree, void *ptr, void (*callback)(void *));
+
+/* Frees retired objects which are no longer visible to any reader (writer only)
+	called automatically when RECLAIM_THRESHOLD objects are retired
+*/
+void PAVLT_Reclaim( PTREE *pTree);
+
+/* Waits until every reader has left the read-side section it was in (writer only)
+*/
+void PAVLT_Synchronize( PTREE *pTree);
+
+/* Registers a reader thread
+	return	reader id
+			-1 if MAX_READERS readers are already registered
+*/
+int PAVLT_ReaderRegister( PTREE *pTree);
+
+/* Unregisters a reader thread
+*/
+void PAVLT_ReaderUnregister( PTREE *pTree, int reader);
+
+/* Enters/leaves a read-side section
+	data returned by PAVLT_Search is valid until PAVLT_ReadUnlock
+*/
+void PAVLT_ReadLock( PTREE *pTree, int reader);
+void PAVLT_ReadUnlock( PTREE *pTree, int reader);
+
+/* Retrieve tree for the node containing the requested key (keyPtr)
+	reader: must be called in a read-side section
+	return	address of data of the node containing the key
+			NULL not found
+*/
+void *PAVLT_Search( PTREE *pTree, void *keyPtr);
+
+/* prints snapshot of tree using inorder traversal
+	reader: must be called in a read-side section
+*/
+void PAVLT_Traverse( PTREE *pTree, void (*callback)(const void *));
+
+/* prints snapshot of tree using right-to-left inorder traversal
+	reader: must be called in a read-side section
+*/
+void PAVLT_TraverseR( PTREE *pTree, void (*callback)(const void *));
+
+/* returns number of nodes in tree
+*/
+int PAVLT_Count( PTREE *pTree);
+
+/* returns height of the tree
+*/
+int PAVLT_Height( PTREE *pTree);
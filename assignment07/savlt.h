@@ -0,0 +1,316 @@
+// string-keyed AVL tree template
+// the comparison is inlined (no function pointer) and each node caches the first 8 bytes of its key,
+// so most comparisons are a single integer compare; strcmp is called only when the prefixes are equal
+//
+// usage:
+//	#define SAVLT_NAME	WT		// prefix of generated types and functions (WT_TREE, WT_Insert, ...)
+//	#define SAVLT_TYPE	tWord	// data type
+//	#define SAVLT_KEY	word	// member of SAVLT_TYPE used as key (char *)
+//	#include "savlt.h"
+//
+// this header can be included several times with different parameters
+
+#include <stdlib.h> // malloc
+#include <string.h> // strcmp
+
+#ifndef SAVLT_COMMON
+#define SAVLT_COMMON
+
+#define SAVLT_CAT_(a, b)	a##_##b
+#define SAVLT_CAT(a, b)		SAVLT_CAT_(a, b)
+
+#define savlt_max(x, y)	(((x) > (y)) ? (x) : (y))
+
+// first 8 bytes of str in big-endian order (padded with 0)
+// comparing two prefixes as integers gives the same order as strcmp
+static inline unsigned long long savlt_prefix( const char *str)
+{
+	unsigned long long prefix = 0;
+
+	for (int i = 0; i < 8 && str[i]; i++)
+		prefix |= (unsigned long long)(unsigned char)str[i] << (56 - 8 * i);
+
+	return prefix;
+}
+
+// compares two keys with their prefixes
+static inline int savlt_compare( unsigned long long p1, const char *s1, unsigned long long p2, const char *s2)
+{
+	if (p1 != p2) return (p1 < p2) ? -1 : 1;
+
+	// the prefixes contain the end of the strings
+	if ((p1 & 0xff) == 0) return 0;
+
+	return strcmp( s1 + 8, s2 + 8);
+}
+
+#endif
+
+#define SAVLT_NODE	SAVLT_CAT(SAVLT_NAME, NODE)
+#define SAVLT_TREE	SAVLT_CAT(SAVLT_NAME, TREE)
+#define SAVLT_FN(f)	SAVLT_CAT(SAVLT_NAME, f)
+
+////////////////////////////////////////////////////////////////////////////////
+// TREE type definition
+typedef struct SAVLT_NODE
+{
+	unsigned long long	prefix; // savlt_prefix of the key
+	SAVLT_TYPE	*dataPtr;
+	struct SAVLT_NODE	*left;
+	struct SAVLT_NODE	*right;
+	int 	height;
+} SAVLT_NODE;
+
+typedef struct
+{
+	int 	count;
+	SAVLT_NODE	*root;
+} SAVLT_TREE;
+
+////////////////////////////////////////////////////////////////////////////////
+// internal functions
+
+static inline int SAVLT_FN(getHeight)( SAVLT_NODE *root)
+{
+	return (root == NULL) ? -1 : root->height;
+}
+
+static inline SAVLT_NODE *SAVLT_FN(rotateRight)( SAVLT_NODE *root)
+{
+	SAVLT_NODE *newroot = root->left;
+	root->left = newroot->right;
+	newroot->right = root;
+
+	root->height = savlt_max( SAVLT_FN(getHeight)( root->left), SAVLT_FN(getHeight)( root->right)) + 1;
+	newroot->height = savlt_max( SAVLT_FN(getHeight)( newroot->left), SAVLT_FN(getHeight)( newroot->right)) + 1;
+
+	return newroot;
+}
+
+static inline SAVLT_NODE *SAVLT_FN(rotateLeft)( SAVLT_NODE *root)
+{
+	SAVLT_NODE *newroot = root->right;
+	root->right = newroot->left;
+	newroot->left = root;
+
+	root->height = savlt_max( SAVLT_FN(getHeight)( root->left), SAVLT_FN(getHeight)( root->right)) + 1;
+	newroot->height = savlt_max( SAVLT_FN(getHeight)( newroot->left), SAVLT_FN(getHeight)( newroot->right)) + 1;
+
+	return newroot;
+}
+
+// fixes height and balancing with rotation
+// return	new root
+static inline SAVLT_NODE *SAVLT_FN(balance)( SAVLT_NODE *root)
+{
+	int lh = SAVLT_FN(getHeight)( root->left);
+	int rh = SAVLT_FN(getHeight)( root->right);
+
+	if (lh > rh + 1)
+	{
+		if (SAVLT_FN(getHeight)( root->left->left) < SAVLT_FN(getHeight)( root->left->right))
+			root->left = SAVLT_FN(rotateLeft)( root->left);
+		return SAVLT_FN(rotateRight)( root);
+	}
+	else if (rh > lh + 1)
+	{
+		if (SAVLT_FN(getHeight)( root->right->right) < SAVLT_FN(getHeight)( root->right->left))
+			root->right = SAVLT_FN(rotateRight)( root->right);
+		return SAVLT_FN(rotateLeft)( root);
+	}
+
+	root->height = savlt_max( lh, rh) + 1;
+	return root;
+}
+
+static inline SAVLT_NODE *SAVLT_FN(insert_)( SAVLT_NODE *root, SAVLT_NODE *newPtr, void (*callback)(SAVLT_TYPE *), int *duplicated)
+{
+	if (root == NULL) return newPtr;
+
+	int cmp = savlt_compare( newPtr->prefix, newPtr->dataPtr->SAVLT_KEY, root->prefix, root->dataPtr->SAVLT_KEY);
+
+	if (cmp < 0)
+		root->left = SAVLT_FN(insert_)( root->left, newPtr, callback, duplicated);
+	else if (cmp > 0)
+		root->right = SAVLT_FN(insert_)( root->right, newPtr, callback, duplicated);
+	else
+	{
+		callback( root->dataPtr);
+		*duplicated = 1;
+		return root;
+	}
+
+	return SAVLT_FN(balance)( root);
+}
+
+static inline SAVLT_NODE *SAVLT_FN(delete_)( SAVLT_NODE *root, unsigned long long prefix, const char *key, SAVLT_TYPE **dataOutPtr)
+{
+	if (root == NULL) return NULL;
+
+	int cmp = savlt_compare( prefix, key, root->prefix, root->dataPtr->SAVLT_KEY);
+
+	if (cmp < 0)
+		root->left = SAVLT_FN(delete_)( root->left, prefix, key, dataOutPtr);
+	else if (cmp > 0)
+		root->right = SAVLT_FN(delete_)( root->right, prefix, key, dataOutPtr);
+	else
+	{
+		*dataOutPtr = root->dataPtr;
+
+		if (root->left == NULL || root->right == NULL)
+		{
+			SAVLT_NODE *child = (root->left == NULL) ? root->right : root->left;
+			free( root);
+			return child;
+		}
+
+		// replaces the data with its successor and deletes the successor
+		SAVLT_NODE *pLoc = root->right;
+		while (pLoc->left) pLoc = pLoc->left;
+
+		SAVLT_TYPE *temp;
+		root->dataPtr = pLoc->dataPtr;
+		root->prefix = pLoc->prefix;
+		root->right = SAVLT_FN(delete_)( root->right, pLoc->prefix, pLoc->dataPtr->SAVLT_KEY, &temp);
+	}
+
+	return SAVLT_FN(balance)( root);
+}
+
+static inline void SAVLT_FN(destroy_)( SAVLT_NODE *root, void (*callback)(SAVLT_TYPE *))
+{
+	if (root == NULL) return;
+
+	SAVLT_FN(destroy_)( root->left, callback);
+	SAVLT_FN(destroy_)( root->right, callback);
+
+	callback( root->dataPtr);
+	free( root);
+}
+
+static inline void SAVLT_FN(traverse_)( SAVLT_NODE *root, void (*callback)(const SAVLT_TYPE *))
+{
+	if (root == NULL) return;
+
+	SAVLT_FN(traverse_)( root->left, callback);
+	callback( root->dataPtr);
+	SAVLT_FN(traverse_)( root->right, callback);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// generated functions (same semantics as avlt.h, but the key is a string)
+
+/* Allocates dynamic memory for a tree head node and returns its address to caller
+	return	head node pointer
+			NULL if overflow
+*/
+static inline SAVLT_TREE *SAVLT_FN(Create)( void)
+{
+	SAVLT_TREE *newtree = (SAVLT_TREE *)malloc( sizeof( SAVLT_TREE));
+	if (newtree == NULL) return NULL;
+
+	newtree->count = 0;
+	newtree->root = NULL;
+
+	return newtree;
+}
+
+/* Deletes all data in tree and recycles memory
+*/
+static inline void SAVLT_FN(Destroy)( SAVLT_TREE *pTree, void (*callback)(SAVLT_TYPE *))
+{
+	SAVLT_FN(destroy_)( pTree->root, callback);
+	free( pTree);
+}
+
+/* Inserts new data into the tree
+	callback은 이미 트리에 존재하는 데이터를 발견했을 때 호출하는 함수
+	return	1 success
+			0 overflow
+			2 if duplicated key
+*/
+static inline int SAVLT_FN(Insert)( SAVLT_TREE *pTree, SAVLT_TYPE *dataInPtr, void (*callback)(SAVLT_TYPE *))
+{
+	SAVLT_NODE *newnode = (SAVLT_NODE *)malloc( sizeof( SAVLT_NODE));
+	if (newnode == NULL) return 0;
+
+	newnode->prefix = savlt_prefix( dataInPtr->SAVLT_KEY);
+	newnode->dataPtr = dataInPtr;
+	newnode->left = NULL;
+	newnode->right = NULL;
+	newnode->height = 0;
+
+	int dup = 0;
+	pTree->root = SAVLT_FN(insert_)( pTree->root, newnode, callback, &dup);
+
+	if (dup)
+	{
+		free( newnode);
+		return 2;
+	}
+
+	pTree->count++;
+	return 1;
+}
+
+/* Deletes a node with key from the tree
+	return	address of data of the node containing the key
+			NULL not found
+*/
+static inline SAVLT_TYPE *SAVLT_FN(Delete)( SAVLT_TREE *pTree, const char *key)
+{
+	SAVLT_TYPE *gom = NULL;
+
+	pTree->root = SAVLT_FN(delete_)( pTree->root, savlt_prefix( key), key, &gom);
+	if (gom != NULL) pTree->count--;
+
+	return gom;
+}
+
+/* Retrieve tree for the node containing the requested key
+	return	address of data of the node containing the key
+			NULL not found
+*/
+static inline SAVLT_TYPE *SAVLT_FN(Search)( SAVLT_TREE *pTree, const char *key)
+{
+	unsigned long long prefix = savlt_prefix( key);
+	SAVLT_NODE *root = pTree->root;
+
+	while (root != NULL)
+	{
+		int cmp = savlt_compare( prefix, key, root->prefix, root->dataPtr->SAVLT_KEY);
+
+		if (cmp < 0) root = root->left;
+		else if (cmp > 0) root = root->right;
+		else return root->dataPtr;
+	}
+	return NULL;
+}
+
+/* prints tree using inorder traversal
+*/
+static inline void SAVLT_FN(Traverse)( SAVLT_TREE *pTree, void (*callback)(const SAVLT_TYPE *))
+{
+	SAVLT_FN(traverse_)( pTree->root, callback);
+}
+
+/* returns number of nodes in tree
+*/
+static inline int SAVLT_FN(Count)( SAVLT_TREE *pTree)
+{
+	return pTree->count;
+}
+
+/* returns height of the tree
+*/
+static inline int SAVLT_FN(Height)( SAVLT_TREE *pTree)
+{
+	return SAVLT_FN(getHeight)( pTree->root);
+}
+
+#undef SAVLT_NODE
+#undef SAVLT_TREE
+#undef SAVLT_FN
+#undef SAVLT_NAME
+#undef SAVLT_TYPE
+#undef SAVLT_KEY
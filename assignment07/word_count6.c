@@ -1,5 +1,5 @@
 #include <stdio.h>
-#include <stdlib.h> // malloc
+#include <stdlib.h> // malloc, realloc, free
 #include <string.h> // strdup, strcmp
 #include <ctype.h> // toupper
 
@@ -90,6 +90,14 @@ void increase_freq(void *dataPtr)
 	((tWord *)dataPtr)->freq++;
 }
 
+// adds frequency of dup to kept and frees dup
+// for AVLT_BuildFromSorted function
+void merge_word(void *kept, void *dup)
+{
+	((tWord *)kept)->freq += ((tWord *)dup)->freq;
+	destroyWord( dup);
+}
+
 // gets user's input
 void input_word(char *word)
 {
@@ -106,6 +114,9 @@ int main( int argc, char **argv)
 	tWord *pWord;
 	int ret;
 	FILE *fp;
+	void **words = NULL; // words of FILE in input order
+	int num_words = 0, capacity = 0;
+	int sorted = 1;
 	
 	if (argc != 2) {
 		fprintf( stderr, "usage: %s FILE\n", argv[0]);
@@ -127,20 +138,53 @@ int main( int argc, char **argv)
 		return 100;
 	}
 	
+	// 단어들을 입력 순서대로 배열에 모음
 	while(fscanf( fp, "%s", word) != EOF)
 	{
 		pWord = createWord( word);
+		if (pWord == NULL) continue;
 		
-		ret = AVLT_Insert( tree, pWord, increase_freq);
-		
-		if (ret == 0 || ret == 2) // failure or duplicated
+		if (num_words == capacity)
 		{
-			destroyWord( pWord);
+			int new_capacity = capacity ? capacity * 2 : 1024;
+			void **new_words = realloc( words, sizeof( void *) * new_capacity);
+			if (new_words == NULL)
+			{
+				fprintf( stderr, "Cannot allocate memory for words\n");
+				destroyWord( pWord);
+				for (int i = 0; i < num_words; i++)
+					destroyWord( words[i]);
+				free( words);
+				AVLT_Destroy( tree, destroyWord);
+				fclose( fp);
+				return 100;
+			}
+			words = new_words;
+			capacity = new_capacity;
 		}
+		
+		if (num_words > 0 && compare_by_word( words[num_words - 1], pWord) > 0) sorted = 0;
+		words[num_words++] = pWord;
 	}
 	
 	fclose( fp);
 	
+	// 정렬된 입력(words_ordered.txt 등)은 O(n)에 균형 트리로 구성
+	// 실패하면 배열은 그대로이므로 하나씩 삽입
+	if (!sorted || !AVLT_BuildFromSorted( tree, words, num_words, merge_word))
+	{
+		for (int i = 0; i < num_words; i++)
+		{
+			ret = AVLT_Insert( tree, words[i], increase_freq);
+			
+			if (ret == 0 || ret == 2) // failure or duplicated
+			{
+				destroyWord( words[i]);
+			}
+		}
+	}
+	free( words);
+	
 	fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, T)ree print, S)earch, D)elete, C)ount, H)eight: ");
 	
 	while (1)
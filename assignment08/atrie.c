@@ -0,0 +1,582 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, realloc
+#include <string.h>	// strlen, memcpy, memmove, memset
+#include <ctype.h>	// tolower
+#ifdef __SSE2__
+#include <emmintrin.h>	// NODE16 lookup
+#endif
+
+#include "atrie.h"
+
+#define KEY_BUF		256 // keys shorter than this are copied on the stack
+
+enum { NODE0, NODE4, NODE16, NODE48, NODE256 };
+
+// subtrees are ordered by key byte; EOW is mapped to 0xff (not in UTF-8), so it comes last as in the pointer trie
+#define keyByte(x)		(((x) == EOW) ? 0xff : (unsigned char)(x))
+
+// 문자: 공백, 제어 문자, 와일드카드('*', '?')와 0xff를 제외한 모든 바이트 (UTF-8 문자는 바이트 단위로 저장)
+#define isValid(x)		((unsigned char)(x) > ' ' && (unsigned char)(x) != 0x7f && (unsigned char)(x) != 0xff \
+							&& (x) != '*' && (x) != '?')
+
+// node layouts of NODE4, NODE16, NODE48, NODE256 (NODE0 is a leaf: header only)
+typedef struct {
+	TRIE			h;
+	unsigned char	keys[4]; // sorted
+	TRIE			*subtrees[4];
+} TRIE4;
+
+typedef struct {
+	TRIE			h;
+	unsigned char	keys[16]; // sorted
+	TRIE			*subtrees[16];
+} TRIE16;
+
+typedef struct {
+	TRIE			h;
+	unsigned char	slot[256]; // 0 (no subtree) or position in subtrees + 1
+	TRIE			*subtrees[48];
+} TRIE48;
+
+typedef struct {
+	TRIE			h;
+	TRIE			*subtrees[256];
+} TRIE256;
+
+static const size_t nodeSize[] = { sizeof(TRIE), sizeof(TRIE4), sizeof(TRIE16), sizeof(TRIE48), sizeof(TRIE256) };
+static const int nodeCapacity[] = { 0, 4, 16, 48, 256 };
+
+// compressed path after the key byte in the parent, stored after the node layout (NUL-terminated)
+#define PREFIX(node)	((char *)(node) + nodeSize[(node)->type])
+
+/* Allocates a node of type with a copy of prefix[0..len-1]
+	used in trieCreateNode, trieInsert, _grow
+*/
+static TRIE *_createNode( int type, const char *prefix, int len, int dic_index)
+{
+	TRIE *newnode = (TRIE *)malloc(nodeSize[type] + len + 1);
+	if (!newnode) return NULL;
+
+	memset(newnode, 0, nodeSize[type]);
+	newnode->index = dic_index;
+	newnode->type = type;
+	memcpy(PREFIX(newnode), prefix, len);
+	PREFIX(newnode)[len] = 0;
+
+	return newnode;
+}
+
+/* return	address of the subtree pointer for key byte b
+			NULL if not found
+	used in trieInsert, trieSearch, _locate
+*/
+static TRIE **_findChild( TRIE *node, unsigned char b)
+{
+	switch (node->type) {
+	case NODE4: {
+		TRIE4 *n = (TRIE4 *)node;
+		for (int i = 0; i < node->num; i++)
+			if (n->keys[i] == b) return &n->subtrees[i];
+		return NULL;
+	}
+	case NODE16: {
+		TRIE16 *n = (TRIE16 *)node;
+#ifdef __SSE2__
+		// compares all 16 keys at once
+		__m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)b), _mm_loadu_si128((__m128i *)n->keys));
+		int mask = _mm_movemask_epi8(cmp) & ((1 << node->num) - 1);
+		if (mask) return &n->subtrees[__builtin_ctz(mask)];
+#else
+		for (int i = 0; i < node->num; i++)
+			if (n->keys[i] == b) return &n->subtrees[i];
+#endif
+		return NULL;
+	}
+	case NODE48: {
+		TRIE48 *n = (TRIE48 *)node;
+		return n->slot[b] ? &n->subtrees[n->slot[b] - 1] : NULL;
+	}
+	case NODE256: {
+		TRIE256 *n = (TRIE256 *)node;
+		return n->subtrees[b] ? &n->subtrees[b] : NULL;
+	}
+	}
+	return NULL;
+}
+
+/* Copies node into a node of the next larger type and frees node
+	return	new node
+			NULL if overflow (node is not changed)
+	used in _addChild
+*/
+static TRIE *_grow( TRIE *node)
+{
+	char *prefix = PREFIX(node);
+	TRIE *newnode = _createNode(node->type + 1, prefix, strlen(prefix), node->index);
+	if (!newnode) return NULL;
+
+	newnode->num = node->num;
+
+	switch (node->type) {
+	case NODE4:
+		memcpy(((TRIE16 *)newnode)->keys, ((TRIE4 *)node)->keys, node->num);
+		memcpy(((TRIE16 *)newnode)->subtrees, ((TRIE4 *)node)->subtrees, sizeof(TRIE *) * node->num);
+		break;
+	case NODE16:
+		for (int i = 0; i < node->num; i++) {
+			((TRIE48 *)newnode)->slot[((TRIE16 *)node)->keys[i]] = i + 1;
+			((TRIE48 *)newnode)->subtrees[i] = ((TRIE16 *)node)->subtrees[i];
+		}
+		break;
+	case NODE48:
+		for (int b = 0; b < 256; b++) {
+			int s = ((TRIE48 *)node)->slot[b];
+			if (s) ((TRIE256 *)newnode)->subtrees[b] = ((TRIE48 *)node)->subtrees[s - 1];
+		}
+		break;
+	}
+
+	free(node);
+	return newnode;
+}
+
+/* Adds child for key byte b to *ref (*ref is replaced by a larger node if it is full)
+	return	1 success
+			0 overflow
+	used in trieInsert
+*/
+static int _addChild( TRIE **ref, unsigned char b, TRIE *child)
+{
+	TRIE *node = *ref;
+
+	if (node->num == nodeCapacity[node->type]) {
+		node = _grow(node);
+		if (!node) return 0;
+		*ref = node;
+	}
+
+	switch (node->type) {
+	case NODE4:
+	case NODE16: {
+		unsigned char *keys = (node->type == NODE4) ? ((TRIE4 *)node)->keys : ((TRIE16 *)node)->keys;
+		TRIE **subtrees = (node->type == NODE4) ? ((TRIE4 *)node)->subtrees : ((TRIE16 *)node)->subtrees;
+		int pos = 0;
+		while (pos < node->num && keys[pos] < b) pos++;
+
+		memmove(keys + pos + 1, keys + pos, node->num - pos);
+		memmove(subtrees + pos + 1, subtrees + pos, sizeof(TRIE *) * (node->num - pos));
+		keys[pos] = b;
+		subtrees[pos] = child;
+		break;
+	}
+	case NODE48:
+		((TRIE48 *)node)->subtrees[node->num] = child;
+		((TRIE48 *)node)->slot[b] = node->num + 1;
+		break;
+	case NODE256:
+		((TRIE256 *)node)->subtrees[b] = child;
+		break;
+	}
+	node->num++;
+
+	return 1;
+}
+
+/* return	next subtree in key order from *pos (*pos is advanced)
+			NULL if no more subtrees
+	used in trieDestroy, trieList_main, _prefixForEach, _forEach, trieMemory
+*/
+static TRIE *_nextChild( TRIE *node, int *pos)
+{
+	switch (node->type) {
+	case NODE4:
+		return (*pos < node->num) ? ((TRIE4 *)node)->subtrees[(*pos)++] : NULL;
+	case NODE16:
+		return (*pos < node->num) ? ((TRIE16 *)node)->subtrees[(*pos)++] : NULL;
+	case NODE48:
+		while (*pos < 256) {
+			int s = ((TRIE48 *)node)->slot[(*pos)++];
+			if (s) return ((TRIE48 *)node)->subtrees[s - 1];
+		}
+		return NULL;
+	case NODE256:
+		while (*pos < 256) {
+			TRIE *child = ((TRIE256 *)node)->subtrees[(*pos)++];
+			if (child) return child;
+		}
+		return NULL;
+	}
+	return NULL;
+}
+
+/* return	key byte of the subtree just returned by _nextChild
+	used in _keyOf, trieAttach
+*/
+static unsigned char _keyByteOf( TRIE *node, int pos)
+{
+	if (node->type == NODE4) return ((TRIE4 *)node)->keys[pos - 1];
+	if (node->type == NODE16) return ((TRIE16 *)node)->keys[pos - 1];
+	return pos - 1;
+}
+
+/* return	character of the subtree just returned by _nextChild
+	used in _forEach
+*/
+static char _keyOf( TRIE *node, int pos)
+{
+	int b = _keyByteOf(node, pos);
+
+	return (b == keyByte(EOW)) ? EOW : (char)b;
+}
+
+/* Finds the node where str ends (str may end in the middle of the node's prefix)
+	return	node pointer
+			NULL if no entry starts with str
+	used in triePrefixList, triePrefixForEach
+*/
+static TRIE *_locate( TRIE *root, const char *str)
+{
+	while (*str) {
+		TRIE **slot = _findChild(root, keyByte(*str));
+		if (!slot) return NULL;
+
+		TRIE *child = *slot;
+		char *p = PREFIX(child);
+		int m = 0;
+		str++;
+		while (p[m] && p[m] == str[m]) m++;
+
+		if (str[m] == 0) return child;
+		if (p[m] != 0) return NULL;
+
+		root = child;
+		str += m;
+	}
+	return root;
+}
+
+TRIE *trieCreateNode(void)
+{
+	// root is dense (almost every letter), so it starts as NODE256 and never grows
+	return _createNode(NODE256, "", 0, -1);
+}
+
+void trieDestroy( TRIE *root)
+{
+	if (!root) return;
+
+	int pos = 0;
+	TRIE *child;
+	while ((child = _nextChild(root, &pos)) != NULL)
+		trieDestroy(child);
+
+	free(root);
+}
+
+int trieInsert( TRIE *root, char *str, int dic_index)
+{
+	char buf[KEY_BUF];
+	int len = strlen(str);
+	char *key = (len < KEY_BUF) ? buf : (char *)malloc(len + 1);
+	int ret = 0;
+
+	if (!key) return 0;
+
+	for (int i = 0; i <= len; i++) {
+		key[i] = tolower((unsigned char)str[i]);
+		if (i < len && !isValid(key[i])) goto end;
+	}
+
+	TRIE *node = root;
+	TRIE **ref = &root; // root is NODE256 (never replaced)
+	char *s = key;
+	while (1) {
+		if (!*s) {
+			if (node->index < 0) {
+				node->index = dic_index;
+				ret = 1;
+			}
+			break; // 중복이면 0
+		}
+
+		unsigned char b = keyByte(*s);
+		TRIE **slot = _findChild(node, b);
+		s++;
+
+		if (!slot) {
+			// new leaf with the rest of the key as prefix
+			TRIE *leaf = _createNode(NODE0, s, strlen(s), dic_index);
+			if (leaf && _addChild(ref, b, leaf)) ret = 1;
+			else free(leaf);
+			break;
+		}
+
+		TRIE *child = *slot;
+		char *p = PREFIX(child);
+		int m = 0;
+		while (p[m] && p[m] == s[m]) m++;
+
+		if (p[m] != 0) {
+			// split the prefix of child at m: node -> mid (p[0..m-1]) -> p[m] -> child (p[m+1..])
+			TRIE *mid = _createNode(NODE4, p, m, -1);
+			if (!mid) break;
+
+			unsigned char pb = keyByte(p[m]);
+			int rest = strlen(p + m + 1);
+			memmove(p, p + m + 1, rest + 1);
+
+			TRIE *shrunk = (TRIE *)realloc(child, nodeSize[child->type] + rest + 1);
+			if (shrunk) child = shrunk;
+
+			_addChild(&mid, pb, child); // NODE4 is empty
+			*slot = mid;
+			child = mid;
+		}
+
+		ref = slot;
+		node = child;
+		s += m;
+	}
+
+end:
+	if (key != buf) free(key);
+	return ret;
+}
+
+int trieSearch( TRIE *root, char *str)
+{
+	char buf[KEY_BUF];
+	int len = strlen(str);
+	char *key = (len + 1 < KEY_BUF) ? buf : (char *)malloc(len + 2);
+	int ret = -1;
+
+	if (!key) return -1;
+
+	// str + EOW (lowercase, as inserted)
+	for (int i = 0; i < len; i++)
+		key[i] = tolower((unsigned char)str[i]);
+	key[len] = EOW;
+	key[len + 1] = 0;
+
+	char *s = key;
+	while (1) {
+		if (!*s) {
+			ret = root->index;
+			break;
+		}
+
+		TRIE **slot = _findChild(root, keyByte(*s));
+		if (!slot) break;
+
+		TRIE *child = *slot;
+		char *p = PREFIX(child);
+		int m = 0;
+		s++;
+		while (p[m] && p[m] == s[m]) m++;
+		if (p[m] != 0) break;
+
+		root = child;
+		s += m;
+	}
+
+	if (key != buf) free(key);
+	return ret;
+}
+
+// used in trieList
+static int trieList_main( TRIE *root, char *dic[], int count)
+{
+	if (root->index >= 0)
+		printf("[%d]%s\n", ++count, dic[root->index]);
+
+	int pos = 0;
+	TRIE *child;
+	while ((child = _nextChild(root, &pos)) != NULL)
+		count = trieList_main(child, dic, count);
+
+	return count;
+}
+
+void trieList( TRIE *root, char *dic[])
+{
+	if (root == NULL) return;
+
+	trieList_main(root, dic, 0);
+}
+
+void triePrefixList( TRIE *root, char *str, char *dic[])
+{
+	trieList(_locate(root, str), dic);
+}
+
+// used in triePrefixForEach
+static void _prefixForEach( TRIE *root, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	if (root->index >= 0)
+		callback(root->index, arg);
+
+	int pos = 0;
+	TRIE *child;
+	while ((child = _nextChild(root, &pos)) != NULL)
+		_prefixForEach(child, callback, arg);
+}
+
+void triePrefixForEach( TRIE *root, char *str, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	TRIE *node = _locate(root, str);
+
+	if (node) _prefixForEach(node, callback, arg);
+}
+
+// growable key buffer for trieForEach
+typedef struct {
+	char	*buf;
+	int		size;
+	void	(*callback)(const char *key, int dic_index, void *arg);
+	void	*arg;
+} tKeyBuf;
+
+/* return	1 if every entry of root is visited
+			0 if the key buffer cannot grow (the walk stops there)
+	used in trieForEach
+*/
+static int _forEach( TRIE *root, tKeyBuf *key, int len)
+{
+	char *prefix = PREFIX(root);
+	int prefixLen = strlen(prefix);
+
+	while (len + prefixLen + 2 > key->size) {
+		char *newbuf = (char *)realloc(key->buf, key->size * 2);
+		if (!newbuf) return 0;
+		key->buf = newbuf;
+		key->size *= 2;
+	}
+	memcpy(key->buf + len, prefix, prefixLen + 1);
+	len += prefixLen;
+
+	if (root->index >= 0)
+		key->callback(key->buf, root->index, key->arg);
+
+	int pos = 0;
+	TRIE *child;
+	while ((child = _nextChild(root, &pos)) != NULL) {
+		key->buf[len] = _keyOf(root, pos);
+		if (!_forEach(child, key, len + 1)) return 0;
+	}
+	return 1;
+}
+
+int trieForEach( TRIE *root, void (*callback)(const char *key, int dic_index, void *arg), void *arg)
+{
+	tKeyBuf key = { (char *)malloc(64), 64, callback, arg };
+	if (!key.buf) return 0;
+
+	int ret = _forEach(root, &key, 0);
+	free(key.buf);
+	return ret;
+}
+
+/* return	1 if subtrees a and b (under the same key byte) have no key in common
+			and differ at the second character
+			0 otherwise
+	used in trieAttach
+*/
+static int _disjoint( TRIE *a, TRIE *b)
+{
+	char *pa = PREFIX(a);
+	char *pb = PREFIX(b);
+
+	if (pa[0] && pb[0]) return keyByte(pa[0]) != keyByte(pb[0]);
+	if (pa[0]) return _findChild(b, keyByte(pa[0])) == NULL;
+	if (pb[0]) return _findChild(a, keyByte(pb[0])) == NULL;
+
+	if (a->index >= 0 && b->index >= 0) return 0;
+
+	int pos = 0;
+	while (_nextChild(b, &pos))
+		if (_findChild(a, _keyByteOf(b, pos))) return 0;
+
+	return 1;
+}
+
+// number of subtrees a brings under its key byte (itself if it has a prefix)
+#define numUnder(a)		(PREFIX(a)[0] ? 1 : (a)->num)
+
+/* Moves a under node (no prefix, large enough not to grow):
+	a node without prefix is replaced by node (its subtrees and entry are moved and it is freed),
+	otherwise a is added for the first character of its prefix
+	used in trieAttach
+*/
+static void _moveUnder( TRIE *node, TRIE *a)
+{
+	char *p = PREFIX(a);
+
+	if (p[0]) {
+		unsigned char b = keyByte(p[0]);
+		memmove(p, p + 1, strlen(p)); // with NUL
+		_addChild(&node, b, a);
+		return;
+	}
+
+	int pos = 0;
+	TRIE *child;
+	while ((child = _nextChild(a, &pos)) != NULL)
+		_addChild(&node, _keyByteOf(a, pos), child);
+	if (a->index >= 0) node->index = a->index;
+	free(a);
+}
+
+int trieAttach( TRIE *root, TRIE *sub)
+{
+	// roots are always NODE256 (trieCreateNode)
+	TRIE256 *r = (TRIE256 *)root;
+	TRIE256 *s = (TRIE256 *)sub;
+	TRIE *common[256] = { NULL }; // new nodes for the key bytes in common
+
+	if (root->index >= 0 && sub->index >= 0) return 0;
+
+	// checks the key bytes in common and allocates their nodes before anything is moved
+	for (int b = 0; b < 256; b++) {
+		if (!r->subtrees[b] || !s->subtrees[b]) continue;
+
+		int num = numUnder(r->subtrees[b]) + numUnder(s->subtrees[b]);
+		int type = NODE4;
+		while (nodeCapacity[type] < num) type++;
+
+		if (_disjoint(r->subtrees[b], s->subtrees[b])) common[b] = _createNode(type, "", 0, -1);
+		if (!common[b]) {
+			for (int i = 0; i < b; i++) free(common[i]);
+			return 0;
+		}
+	}
+
+	for (int b = 0; b < 256; b++) {
+		if (!s->subtrees[b]) continue;
+
+		if (common[b]) {
+			_moveUnder(common[b], r->subtrees[b]);
+			_moveUnder(common[b], s->subtrees[b]);
+			r->subtrees[b] = common[b];
+		}
+		else {
+			r->subtrees[b] = s->subtrees[b];
+			root->num++;
+		}
+	}
+	if (sub->index >= 0) root->index = sub->index;
+
+	free(sub);
+	return 1;
+}
+
+size_t trieMemory( TRIE *root)
+{
+	size_t size = nodeSize[root->type] + strlen(PREFIX(root)) + 1;
+
+	int pos = 0;
+	TRIE *child;
+	while ((child = _nextChild(root, &pos)) != NULL)
+		size += trieMemory(child);
+
+	return size;
+}
@@ -0,0 +1,485 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, realloc, qsort
+#include <string.h>	// strdup, strlen, strpbrk
+#include <time.h>	// clock, clock_gettime
+#include <pthread.h>
+
+// permuterm index benchmark
+// the same source is linked with each trie implementation (TRIE_HEADER is set by Makefile)
+// usage: bench_trie FILE [QUERIES [THREADS]]
+//	QUERIES: batch of exact and wildcard queries (one per line, as typed to permuterm_trie)
+//	which is run on each index with THREADS threads (default 1) for throughput and latency percentiles
+
+#ifndef TRIE_HEADER
+#define TRIE_HEADER	"trie.h"
+#endif
+
+#include TRIE_HEADER
+#include "strie.h"
+#include "sarray.h"
+#include "wildcard.h"
+#include "dict.h"
+#include "permuterm.h"
+
+#ifndef TRIE_NAME
+#define TRIE_NAME	"pointer"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+static double elapsed( clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static int trie_insert( void *index, char *key, int dic_index)
+{
+	return trieInsert( (TRIE *)index, key, dic_index);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// entries of the trie collected by trieForEach (for strieBuild)
+typedef struct {
+	char	**keys;
+	int		*index;
+	int		num;
+	int		failed; // overflow (the rest of the entries are not collected)
+} tEntries;
+
+// keys and index have room for all permuterms
+void collect_entry( const char *key, int dic_index, void *arg)
+{
+	tEntries *e = (tEntries *)arg;
+
+	if (e->failed) return;
+
+	e->keys[e->num] = strdup( key);
+	if (e->keys[e->num] == NULL)
+	{
+		e->failed = 1;
+		return;
+	}
+	e->index[e->num++] = dic_index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// wildcard queries (single and multiple '*', '?')
+static char *patterns[] = {
+	"ab*", "*tion", "a*e", "*zz*", "pre*ing", "?at", "c?t*", "a*b*c", "*ou?h*", "*a*e*i*o*u*",
+};
+#define NUM_PATTERNS	(int)(sizeof( patterns) / sizeof( patterns[0]))
+
+static void trie_prefix( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	triePrefixForEach( (TRIE *)index, prefix, callback, arg);
+}
+
+static void strie_prefix( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	striePrefixForEach( (STRIE *)index, prefix, callback, arg);
+}
+
+static void sarray_prefix( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	sarrayPrefixForEach( (SARRAY *)index, prefix, callback, arg);
+}
+
+static void count_entry( int dic_index, void *arg)
+{
+	(void)dic_index;
+	(*(long *)arg)++;
+}
+
+// runs every pattern 10 times
+static void bench_wildcard( const char *name, void *index, tPrefixForEach prefix_for_each, int num_words, char *dic[])
+{
+	long matched = 0;
+	clock_t start = clock();
+
+	for (int k = 0; k < 10; k++)
+		for (int i = 0; i < NUM_PATTERNS; i++)
+			wildcardSearch( index, prefix_for_each, patterns[i], num_words, dic, count_entry, &matched);
+
+	printf( "%-8s wildcard %.1f us/query (%ld matched)\n", name,
+		elapsed( start) * 1e6 / (10.0 * NUM_PATTERNS), matched / 10);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch of queries
+
+// an index under test
+typedef struct {
+	const char		*name;
+	void			*index;
+	int				(*search)( void *index, char *str);
+	tPrefixForEach	prefix_for_each;
+} tIndex;
+
+static int trie_search( void *index, char *str)
+{
+	return trieSearch( (TRIE *)index, str);
+}
+
+static int strie_search( void *index, char *str)
+{
+	return strieSearch( (STRIE *)index, str);
+}
+
+static int sarray_search( void *index, char *str)
+{
+	return sarraySearch( (SARRAY *)index, str);
+}
+
+// queries of a thread: first, first + step, ...
+typedef struct {
+	tIndex	*index;
+	char	**queries;
+	int		num_queries;
+	char	**dic;
+	int		num_words;
+	double	*latency; // seconds of each query
+	int		first;
+	int		step;
+	long	matched;
+} tBatch;
+
+static double now( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *batch_worker( void *arg)
+{
+	tBatch *b = (tBatch *)arg;
+
+	for (int i = b->first; i < b->num_queries; i += b->step)
+	{
+		char *q = b->queries[i];
+		double t = now();
+
+		if (strpbrk( q, "*?"))
+			wildcardSearch( b->index->index, b->index->prefix_for_each, q, b->num_words, b->dic, count_entry, &b->matched);
+		else
+			b->matched += (b->index->search( b->index->index, q) >= 0);
+
+		b->latency[i] = now() - t;
+	}
+	return NULL;
+}
+
+static int compare_double( const void *p1, const void *p2)
+{
+	double d1 = *(const double *)p1, d2 = *(const double *)p2;
+
+	return (d1 > d2) - (d1 < d2);
+}
+
+// nearest-rank percentile (per mille) of sorted[0 .. n-1], i.e. sorted[ceil(n * per_mille / 1000) - 1]
+static double percentile( double *sorted, int n, int per_mille)
+{
+	return sorted[((long)n * per_mille + 999) / 1000 - 1];
+}
+
+// prints mean, p50, p99, p999 and max of latency[0 .. n-1] (latency is sorted)
+static void print_latency( const char *name, const char *type, double *latency, int n)
+{
+	double sum = 0;
+
+	if (n == 0) return;
+
+	qsort( latency, n, sizeof( double), compare_double);
+	for (int i = 0; i < n; i++)
+		sum += latency[i];
+
+	printf( "%-8s %-8s %7d queries: mean %.1f us, p50 %.1f us, p99 %.1f us, p999 %.1f us, max %.1f us\n",
+		name, type, n, sum * 1e6 / n, percentile( latency, n, 500) * 1e6,
+		percentile( latency, n, 990) * 1e6, percentile( latency, n, 999) * 1e6, latency[n - 1] * 1e6);
+}
+
+// runs all queries on index with num_threads threads (at most one thread per query)
+// return 1 on success, 0 if a thread cannot be created
+static int bench_batch( tIndex *index, char **queries, int num_queries, int num_threads, int num_words, char *dic[])
+{
+	if (num_threads > num_queries) num_threads = num_queries > 0 ? num_queries : 1;
+	
+	double *latency = malloc( sizeof( double) * num_queries);
+	double *exact = malloc( sizeof( double) * num_queries);
+	double *wildcard = malloc( sizeof( double) * num_queries);
+	tBatch *batches = malloc( sizeof( tBatch) * num_threads);
+	pthread_t *threads = malloc( sizeof( pthread_t) * num_threads);
+	int num_exact = 0, num_wildcard = 0, started = 0;
+	long matched = 0;
+
+	if (!latency || !exact || !wildcard || !batches || !threads)
+	{
+		fprintf( stderr, "Out of memory\n");
+		exit( 1);
+	}
+
+	double start = now();
+	for (; started < num_threads; started++)
+	{
+		batches[started] = (tBatch){ index, queries, num_queries, dic, num_words, latency, started, num_threads, 0 };
+		if (pthread_create( &threads[started], NULL, batch_worker, &batches[started]) != 0)
+		{
+			fprintf( stderr, "Cannot create thread %d\n", started);
+			break;
+		}
+	}
+	for (int t = 0; t < started; t++)
+	{
+		pthread_join( threads[t], NULL);
+		matched += batches[t].matched;
+	}
+	double sec = now() - start;
+	
+	// the queries of the threads not started are not run
+	if (started < num_threads)
+	{
+		fprintf( stderr, "%-8s batch failed\n", index->name);
+		free( latency);
+		free( exact);
+		free( wildcard);
+		free( batches);
+		free( threads);
+		return 0;
+	}
+
+	for (int i = 0; i < num_queries; i++)
+	{
+		if (strpbrk( queries[i], "*?")) wildcard[num_wildcard++] = latency[i];
+		else exact[num_exact++] = latency[i];
+	}
+
+	printf( "%-8s batch %d queries, %d threads: %.3fs, %.0f queries/s (%ld found or matched)\n",
+		index->name, num_queries, num_threads, sec, num_queries / sec, matched);
+	print_latency( index->name, "exact", exact, num_exact);
+	print_latency( index->name, "wildcard", wildcard, num_wildcard);
+
+	free( latency);
+	free( exact);
+	free( wildcard);
+	free( batches);
+	free( threads);
+	return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	TRIE *trie;
+	DICT *dict;
+	char **dic;
+	int num_words;
+	long num_permuterms = 0;
+	FILE *fp;
+	clock_t start;
+	double sec;
+	int found = 0;
+	
+	DICT *queries = NULL;
+	int num_threads = 1;
+	int ret = 0;
+	
+	if (argc < 2 || argc > 4 || (argc == 4 && atoi( argv[3]) <= 0))
+	{
+		fprintf( stderr, "Usage: %s FILE [QUERIES [THREADS]]\n", argv[0]);
+		return 1;
+	}
+	
+	if (argc >= 3)
+	{
+		fp = fopen( argv[2], "rt");
+		if (fp == NULL)
+		{
+			fprintf( stderr, "File open error: %s\n", argv[2]);
+			return 1;
+		}
+		queries = dictCreate();
+		if (queries == NULL || dictLoad( queries, fp) < 0)
+		{
+			fprintf( stderr, "Cannot read queries: %s\n", argv[2]);
+			return 1;
+		}
+		fclose( fp);
+		if (argc == 4) num_threads = atoi( argv[3]);
+	}
+	
+	fp = fopen( argv[1], "rt");
+	if (fp == NULL)
+	{
+		fprintf( stderr, "File open error: %s\n", argv[1]);
+		return 1;
+	}
+	
+	dict = dictCreate();
+	if (dict == NULL || dictLoad( dict, fp) < 0)
+	{
+		fprintf( stderr, "Cannot read words: %s\n", argv[1]);
+		return 1;
+	}
+	fclose( fp);
+	dic = dict->words;
+	num_words = dict->num;
+	
+	// build: all rotations of word$ (as permuterm_trie)
+	start = clock();
+	trie = trieCreateNode();
+	for (int i = 0; i < num_words; i++)
+		num_permuterms += permutermInsert( trie, trie_insert, dic[i], i, NULL);
+	sec = elapsed( start);
+	printf( "%-8s build %.3fs, %zu bytes\n", TRIE_NAME, sec, trieMemory( trie));
+	
+	// exact search of every word
+	start = clock();
+	for (int k = 0; k < 10; k++)
+		for (int i = 0; i < num_words; i++)
+			found += (trieSearch( trie, dic[i]) >= 0);
+	sec = elapsed( start);
+	printf( "%-8s search %.1f ns/op (%d found)\n", TRIE_NAME, sec * 1e9 / (10.0 * num_words), found / 10);
+	
+	// static trie
+	tEntries e = { malloc( sizeof( char *) * num_permuterms), malloc( sizeof( int) * num_permuterms), 0, 0 };
+	STRIE *frozen = NULL;
+	if (e.keys && e.index)
+	{
+		int visited = trieForEach( trie, collect_entry, &e);
+		start = clock();
+		if (visited && !e.failed) frozen = strieBuild( e.num, e.keys, e.index, num_words, dic);
+		sec = elapsed( start);
+	}
+	for (int i = 0; i < e.num; i++)
+		free( e.keys[i]);
+	free( e.keys);
+	free( e.index);
+	if (frozen == NULL)
+	{
+		fprintf( stderr, "Cannot freeze the trie\n");
+		return 1;
+	}
+	printf( "%-8s freeze %.3fs, %zu bytes\n", "static", sec, strieMemory( frozen));
+	
+	found = 0;
+	start = clock();
+	for (int k = 0; k < 10; k++)
+		for (int i = 0; i < num_words; i++)
+			found += (strieSearch( frozen, dic[i]) >= 0);
+	sec = elapsed( start);
+	printf( "%-8s search %.1f ns/op (%d found)\n", "static", sec * 1e9 / (10.0 * num_words), found / 10);
+	
+	// suffix array
+	start = clock();
+	SARRAY *sa = sarrayBuild( num_words, dic);
+	sec = elapsed( start);
+	printf( "%-8s build %.3fs, %zu bytes\n", "sarray", sec, sarrayMemory( sa));
+	
+	found = 0;
+	start = clock();
+	for (int k = 0; k < 10; k++)
+		for (int i = 0; i < num_words; i++)
+			found += (sarraySearch( sa, dic[i]) >= 0);
+	sec = elapsed( start);
+	printf( "%-8s search %.1f ns/op (%d found)\n", "sarray", sec * 1e9 / (10.0 * num_words), found / 10);
+	
+	// pages of 100 words starting with 'a' ("$a" in the permuterm index)
+	int page[100];
+	int pages = 0, listed = 0, cursor = 0;
+	start = clock();
+	do {
+		listed += striePrefixPage( frozen, "$a", &cursor, 100, page);
+		pages++;
+	} while (cursor >= 0);
+	sec = elapsed( start);
+	printf( "%-8s page %.1f us/page (%d pages, %d words)\n", "static", sec * 1e6 / pages, pages, listed);
+	
+	pages = listed = cursor = 0;
+	start = clock();
+	do {
+		listed += sarrayPrefixPage( sa, "$a", &cursor, 100, page);
+		pages++;
+	} while (cursor >= 0);
+	sec = elapsed( start);
+	printf( "%-8s page %.1f us/page (%d pages, %d words)\n", "sarray", sec * 1e6 / pages, pages, listed);
+	
+	// top-10 completions of "aa" ~ "zz" (the earlier a word is in the file, the higher its score)
+	int *score = malloc( sizeof( int) * num_words);
+	for (int i = 0; i < num_words; i++)
+		score[i] = num_words - i;
+	start = clock();
+	strieSetScores( frozen, score);
+	sec = elapsed( start);
+	printf( "%-8s scores %.3fs\n", "static", sec);
+	free( score);
+	
+	found = 0;
+	start = clock();
+	for (char a = 'a'; a <= 'z'; a++)
+		for (char b = 'a'; b <= 'z'; b++)
+		{
+			char prefix[4] = { '$', a, b, 0 };
+			found += strieTopK( frozen, prefix, 10, page);
+		}
+	sec = elapsed( start);
+	printf( "%-8s top-10 %.1f us/query (%d words)\n", "static", sec * 1e6 / (26 * 26), found);
+	
+	bench_wildcard( TRIE_NAME, trie, trie_prefix, num_words, dic);
+	bench_wildcard( "static", frozen, strie_prefix, num_words, dic);
+	bench_wildcard( "sarray", sa, sarray_prefix, num_words, dic);
+	
+	if (queries)
+	{
+		tIndex indexes[] = {
+			{ TRIE_NAME, trie, trie_search, trie_prefix },
+			{ "static", frozen, strie_search, strie_prefix },
+			{ "sarray", sa, sarray_search, sarray_prefix },
+		};
+		
+		for (int i = 0; i < 3; i++)
+			if (!bench_batch( &indexes[i], queries->words, queries->num, num_threads, num_words, dic))
+				ret = 1;
+	}
+	
+	// prefix listing of "aa" ~ "zz" (output is discarded)
+	fflush( stdout);
+	FILE *out = freopen( "/dev/null", "w", stdout);
+	start = clock();
+	for (char a = 'a'; a <= 'z'; a++)
+		for (char b = 'a'; b <= 'z'; b++)
+		{
+			char prefix[3] = { a, b, 0 };
+			triePrefixList( trie, prefix, dic);
+		}
+	sec = elapsed( start);
+	if (out) fprintf( stderr, "%-8s prefix list %.3fs\n", TRIE_NAME, sec);
+	
+	start = clock();
+	for (char a = 'a'; a <= 'z'; a++)
+		for (char b = 'a'; b <= 'z'; b++)
+		{
+			char prefix[3] = { a, b, 0 };
+			striePrefixList( frozen, prefix, dic);
+		}
+	sec = elapsed( start);
+	if (out) fprintf( stderr, "%-8s prefix list %.3fs\n", "static", sec);
+	
+	start = clock();
+	for (char a = 'a'; a <= 'z'; a++)
+		for (char b = 'a'; b <= 'z'; b++)
+		{
+			char prefix[3] = { a, b, 0 };
+			sarrayPrefixList( sa, prefix, dic);
+		}
+	sec = elapsed( start);
+	if (out) fprintf( stderr, "%-8s prefix list %.3fs\n", "sarray", sec);
+	
+	sarrayDestroy( sa);
+	strieDestroy( frozen);
+	trieDestroy( trie);
+	dictDestroy( dict);
+	dictDestroy( queries);
+	
+	return ret;
+}
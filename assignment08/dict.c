@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, realloc
+#include <string.h>	// memcpy
+#include <ctype.h>	// isspace
+
+#include "dict.h"
+
+#define BLOCK_SIZE	(1 << 20) // bytes of an arena block
+#define INIT_WORDS	1024
+
+/* Allocates an arena block with size bytes of data
+	used in dictAdd
+*/
+static tDictBlock *_createBlock( size_t size)
+{
+	tDictBlock *block = (tDictBlock *)malloc(sizeof(tDictBlock) + size);
+	if (!block) return NULL;
+
+	block->next = NULL;
+	block->used = 0;
+	block->size = size;
+
+	return block;
+}
+
+DICT *dictCreate(void)
+{
+	DICT *dict = (DICT *)malloc(sizeof(DICT));
+	if (!dict) return NULL;
+
+	dict->words = NULL;
+	dict->num = 0;
+	dict->capacity = 0;
+	dict->blocks = NULL;
+	dict->bytes = 0;
+
+	return dict;
+}
+
+void dictDestroy( DICT *dict)
+{
+	if (!dict) return;
+
+	while (dict->blocks) {
+		tDictBlock *next = dict->blocks->next;
+		free(dict->blocks);
+		dict->blocks = next;
+	}
+	free(dict->words);
+	free(dict);
+}
+
+int dictAdd( DICT *dict, const char *str, int len)
+{
+	tDictBlock *block = dict->blocks;
+	char *word;
+
+	if (dict->num == dict->capacity) {
+		int capacity = dict->capacity ? dict->capacity * 2 : INIT_WORDS;
+		char **newWords = (char **)realloc(dict->words, sizeof(char *) * capacity);
+		if (!newWords) return -1;
+		dict->words = newWords;
+		dict->capacity = capacity;
+	}
+
+	if (!block || block->used + len + 1 > block->size) {
+		if (len + 1 > BLOCK_SIZE / 2) {
+			// a long word gets a block of its own behind the one being filled
+			block = _createBlock(len + 1);
+			if (!block) return -1;
+			if (dict->blocks) {
+				block->next = dict->blocks->next;
+				dict->blocks->next = block;
+			}
+			else dict->blocks = block;
+		}
+		else {
+			block = _createBlock(BLOCK_SIZE);
+			if (!block) return -1;
+			block->next = dict->blocks;
+			dict->blocks = block;
+		}
+	}
+
+	word = block->data + block->used;
+	memcpy(word, str, len);
+	word[len] = 0;
+	block->used += len + 1;
+
+	dict->words[dict->num] = word;
+	dict->bytes += len + 1;
+
+	return dict->num++;
+}
+
+int readToken( FILE *fp, char **buf, size_t *size)
+{
+	int c, len = 0;
+
+	while ((c = getc(fp)) != EOF && isspace(c))
+		;
+	if (c == EOF) return -1;
+
+	do {
+		if (len + 1 >= (int)*size) {
+			size_t newSize = *size ? *size * 2 : 64;
+			char *newBuf = (char *)realloc(*buf, newSize);
+			if (!newBuf) return -2;
+			*buf = newBuf;
+			*size = newSize;
+		}
+		(*buf)[len++] = c;
+	} while ((c = getc(fp)) != EOF && !isspace(c));
+
+	(*buf)[len] = 0;
+	return len;
+}
+
+int dictLoad( DICT *dict, FILE *fp)
+{
+	char *buf = NULL;
+	size_t size = 0;
+	int len, num = 0;
+
+	while ((len = readToken(fp, &buf, &size)) >= 0) {
+		if (dictAdd(dict, buf, len) < 0) {
+			num = -1;
+			break;
+		}
+		num++;
+	}
+	if (len == -2) num = -1;
+
+	free(buf);
+	return num;
+}
+
+size_t dictMemory( DICT *dict)
+{
+	size_t size = sizeof(DICT) + sizeof(char *) * dict->capacity;
+
+	for (tDictBlock *block = dict->blocks; block; block = block->next)
+		size += sizeof(tDictBlock) + block->size;
+
+	return size;
+}
@@ -0,0 +1,57 @@
+#include <stdio.h> // FILE
+#include <stddef.h> // size_t
+
+// growable dictionary (string table)
+// words are copied into large arena blocks (no malloc per word) and never move,
+// so words[i] stays valid while the dictionary grows
+
+// arena block
+typedef struct dictBlock {
+	struct dictBlock	*next;
+	size_t				used;
+	size_t				size;
+	char				data[];
+} tDictBlock;
+
+// DICT type definition
+typedef struct {
+	char		**words; // words[0 .. num-1] (may move when the dictionary grows)
+	int			num;
+	int			capacity;
+	tDictBlock	*blocks; // the first block is the one being filled
+	size_t		bytes; // total length of words (with 0s)
+} DICT;
+
+/* Allocates an empty dictionary
+	return	dictionary
+			NULL if overflow
+*/
+DICT *dictCreate(void);
+
+/* Recycles memory for dictionary (and all its words)
+*/
+void dictDestroy( DICT *dict);
+
+/* Appends a copy of str[0 .. len-1] (str may not end with 0)
+	return	index of the word
+			-1 overflow
+*/
+int dictAdd( DICT *dict, const char *str, int len);
+
+/* Reads a token (a run of non-blank characters) of any length from fp into *buf
+	*buf is grown by realloc as needed (*buf may be NULL and *size 0 at first)
+	return	length of the token
+			-1 end of file
+			-2 overflow (*buf cannot grow)
+*/
+int readToken( FILE *fp, char **buf, size_t *size);
+
+/* Appends all tokens of fp
+	return	number of words added
+			-1 overflow
+*/
+int dictLoad( DICT *dict, FILE *fp);
+
+/* return	number of bytes used by words, blocks and the array of words
+*/
+size_t dictMemory( DICT *dict);
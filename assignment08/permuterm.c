@@ -0,0 +1,51 @@
+#include <stdlib.h>	// malloc
+#include <string.h>	// strlen, strchr, memcpy
+#include <ctype.h>	// tolower
+
+#include "permuterm.h"
+
+#define EOW			'$' // end of word
+#define ROT_BUF		202 // words shorter than 100 bytes are rotated on the stack
+
+// UTF-8 continuation byte
+#define isContinuation(x)	(((unsigned char)(x) & 0xc0) == 0x80)
+
+int permutermPart( const char *rot)
+{
+	int c = tolower((unsigned char)rot[0]); // tries store keys in lowercase
+
+	if (c < 0xc0) return c;
+	return 256 + (c - 0xc0) * 64 + (tolower((unsigned char)rot[1]) & 0x3f);
+}
+
+int permutermInsert( void *index, tInsert insert, char *str, int dic_index, const unsigned char *part)
+{
+	char buf[ROT_BUF];
+	int len = strlen(str);
+	char *rot;
+	int num = 0;
+
+	if (strchr(str, EOW)) return 0;
+
+	rot = (2 * len + 2 <= ROT_BUF) ? buf : (char *)malloc(2 * len + 2);
+	if (!rot) return 0;
+
+	memcpy(rot, str, len);
+	rot[len] = EOW;
+	memcpy(rot + len + 1, str, len);
+	rot[2 * len + 1] = 0;
+
+	for (int i = 0; i <= len; i++) {
+		if (isContinuation(rot[i])) continue;
+		if (part && !part[permutermPart(rot + i)]) continue;
+
+		// rotation i ends at i + len + 1 (terminated in place)
+		char c = rot[i + len + 1];
+		rot[i + len + 1] = 0;
+		num += insert(index, rot + i, dic_index);
+		rot[i + len + 1] = c;
+	}
+
+	if (rot != buf) free(rot);
+	return num;
+}
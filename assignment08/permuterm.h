@@ -0,0 +1,23 @@
+// rotations of words for permuterm indexes (shared by permuterm_trie and bench_trie)
+// the rotations of word$ are the substrings of word$word at offsets 0 ~ len, each len+1 characters long
+// ex) "abc" -> "abc$abc": "abc$", "bc$a", "c$ab", "$abc"
+// UTF-8 words are rotated by characters (a rotation does not start at a continuation byte)
+
+// insertion of a key into an index (trieInsert of each trie)
+typedef int (*tInsert)( void *index, char *key, int dic_index);
+
+// partitions of rotations for the parallel build: the first byte, and for a UTF-8 lead byte (0xc0 ~ 0xff)
+// also the low 6 bits of the second byte, since most Hangul syllables share a few lead bytes
+// (a whole partition goes to one worker, so the tries of workers can be attached, see trieAttach)
+#define NUM_PARTS	(256 + 64 * 64)
+
+/* return	partition of rotation (at least two characters; case-insensitive)
+*/
+int permutermPart( const char *rot);
+
+/* Inserts the rotations of str$ into index without making a string for each of them
+	words containing EOW ('$') are not inserted
+	part: NULL, or the partitions of the rotations to insert (part[permutermPart( rotation)] != 0)
+	return	number of rotations inserted
+*/
+int permutermInsert( void *index, tInsert insert, char *str, int dic_index, const unsigned char *part);
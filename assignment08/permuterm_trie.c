@@ -1,254 +1,440 @@
 #include <stdio.h>
 #include <stdlib.h>	// malloc
-#include <string.h>	// strdup
-#include <ctype.h>	// isupper, tolower
+#include <string.h>	// strcmp, strpbrk, strlen
+#include <time.h>	// clock, clock_gettime
+#include <pthread.h>
 
-#define MAX_DEGREE	27 // 'a' ~ 'z' and EOW
-#define EOW			'$' // end of word
+#ifndef TRIE_HEADER
+#define TRIE_HEADER	"trie.h" // pointer trie; "rtrie.h" for radix trie
+#endif
 
-// used in the following functions: trieInsert, trieSearch, triePrefixList
-#define getIndex(x)		(((x) == EOW) ? MAX_DEGREE-1 : ((x) - 'a'))
-
-// TRIE type definition
-typedef struct trieNode {
-	int 			index; // -1 (non-word), 0, 1, 2, ...
-	struct trieNode	*subtrees[MAX_DEGREE];
-} TRIE;
+#include TRIE_HEADER
+#include "strie.h"
+#include "sarray.h"
+#include "wildcard.h"
+#include "dict.h"
+#include "permuterm.h"
 
 ////////////////////////////////////////////////////////////////////////////////
-// Prototype declarations
-
-/* Allocates dynamic memory for a trie node and returns its address to caller
-	return	node pointer
-			NULL if overflow
-*/
-TRIE *trieCreateNode(void)
+// insertion of a rotation for permutermInsert
+int trie_insert( void *index, char *key, int dic_index)
 {
-    TRIE *newnode = (TRIE*)malloc(sizeof(TRIE));
-    if (!newnode) return NULL;
-
-    newnode->index = -1; // 초기값 -1로 설정
-    for (int i = 0; i < MAX_DEGREE; i++) {
-        newnode->subtrees[i] = NULL; // 초기화 수정
-    }
-
-    return newnode;
+	return trieInsert( (TRIE *)index, key, dic_index);
 }
 
-/* Deletes all data in trie and recycles memory
-*/
-void trieDestroy( TRIE *root)
-{
-    if (!root) return;
-
-    for (int i = 0; i < MAX_DEGREE; i++) {
-        if (root->subtrees[i]) {
-            trieDestroy(root->subtrees[i]);
-        }
-    }
+////////////////////////////////////////////////////////////////////////////////
+// parallel build: the rotations are partitioned by their first characters (permutermPart),
+// each worker builds a trie of its own partitions, and the tries are attached under one root
+typedef struct {
+	TRIE			*trie;
+	char			**dic;
+	int				num_words;
+	unsigned char	part[NUM_PARTS]; // partitions of the worker
+	long			num_permuterms;
+} tWorker;
 
-    free(root); // 모든 하위 노드를 해제한 후 루트 노드 해제
+void *build_worker( void *arg)
+{
+	tWorker *w = (tWorker *)arg;
+	
+	w->trie = trieCreateNode();
+	if (w->trie == NULL) return NULL;
+	
+	// words are inserted in the same order as the serial build (the first of duplicates wins)
+	for (int i = 0; i < w->num_words; i++)
+		w->num_permuterms += permutermInsert( w->trie, trie_insert, w->dic[i], i, w->part);
+	
+	return NULL;
 }
 
-/* Inserts new entry into the trie
-	return	1 success
-			0 failure
+/* builds permuterm trie of dic[0 .. num_words-1] with num_threads threads
+	(at most one thread per non-empty partition)
+	return	trie
+			NULL if overflow or a thread cannot be created
 */
-// 주의! 엔트리를 중복 삽입하지 않도록 체크해야 함
-// 대소문자를 소문자로 통일하여 삽입
-// 영문자와 EOW 외 문자를 포함하는 문자열은 삽입하지 않음
-int trieInsert( TRIE *root, char *str, int dic_index)
+TRIE *build_parallel( char *dic[], int num_words, int num_threads, long *num_permuterms)
 {
-	if(!*str){
-		root->index = dic_index;
-		return 1;
+	long *count = calloc( NUM_PARTS, sizeof( long)); // # of rotations of each partition
+	long *load = NULL;
+	tWorker *workers = NULL;
+	pthread_t *threads = NULL;
+	TRIE *root = NULL;
+	int num_parts = 0;
+	int started = 0;
+	int ok = 1;
+	
+	*num_permuterms = 0;
+	if (count == NULL) return NULL;
+	
+	for (int i = 0; i < num_words; i++)
+	{
+		int len = strlen( dic[i]);
+		char *p = dic[i];
+		
+		for (int j = 0; j < len; j++)
+		{
+			if (((unsigned char)p[j] & 0xc0) == 0x80) continue;
+			// the second byte of a rotation starting at the last character is EOW
+			char two[2] = { p[j], (j + 1 < len) ? p[j + 1] : '$' };
+			count[permutermPart( two)]++;
+		}
+		count['$']++;
+	}
+	for (int c = 0; c < NUM_PARTS; c++)
+		if (count[c]) num_parts++;
+	
+	if (num_threads > num_parts) num_threads = num_parts;
+	if (num_threads < 1) num_threads = 1;
+	
+	load = calloc( num_threads, sizeof( long));
+	workers = calloc( num_threads, sizeof( tWorker));
+	threads = malloc( sizeof( pthread_t) * num_threads);
+	if (load == NULL || workers == NULL || threads == NULL)
+	{
+		free( count);
+		free( load);
+		free( workers);
+		free( threads);
+		return NULL;
+	}
+	
+	// partitions in decreasing order of count, each to the least loaded worker
+	while (1)
+	{
+		int c = 0, t = 0;
+		for (int i = 1; i < NUM_PARTS; i++)
+			if (count[i] > count[c]) c = i;
+		if (count[c] == 0) break;
+		
+		for (int i = 1; i < num_threads; i++)
+			if (load[i] < load[t]) t = i;
+		workers[t].part[c] = 1;
+		load[t] += count[c];
+		count[c] = 0;
+	}
+	
+	for (started = 0; started < num_threads; started++)
+	{
+		workers[started].dic = dic;
+		workers[started].num_words = num_words;
+		if (pthread_create( &threads[started], NULL, build_worker, &workers[started]) != 0)
+		{
+			fprintf( stderr, "Cannot create thread %d\n", started);
+			ok = 0;
+			break;
+		}
+	}
+	
+	for (int t = 0; t < started; t++)
+	{
+		pthread_join( threads[t], NULL);
+		if (workers[t].trie == NULL) ok = 0;
+		*num_permuterms += workers[t].num_permuterms;
+	}
+	
+	root = workers[0].trie;
+	for (int t = 1; t < started; t++)
+	{
+		// subtries have no two first characters in common, so attaching fails only by overflow
+		if (ok && !trieAttach( root, workers[t].trie)) ok = 0;
+		if (!ok) trieDestroy( workers[t].trie);
 	}
-	TRIE** sub = &root->subtrees[getIndex(*str)];
-	if(!*sub){
-		*sub = trieCreateNode();
-		if(!*sub) return 0;
+	if (!ok)
+	{
+		trieDestroy( root);
+		root = NULL;
 	}
-	return trieInsert(*sub, str+1, dic_index);
+	
+	free( count);
+	free( load);
+	free( workers);
+	free( threads);
+	return root;
 }
 
-/* Retrieve trie for the requested key
-	return	index in dictionary (trie) if key found
-			-1 key not found
-*/
-int trieSearch( TRIE *root, char *str)
+// elapsed (wall-clock) seconds; clock() adds up the time of all threads
+double wall_time( void)
 {
-	if(!*str){
-		if(!root->subtrees[26]) 
-			return -1;
-		else
-			return root->subtrees[26]->index;
-	}
-
-	if (!root) 
-		return -1;
-	else 
-		return trieSearch(root->subtrees[getIndex(*str)], str+1);
-
+	struct timespec ts;
+	
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
 }
 
-/* prints all entries in trie using preorder traversal
-*/
-void trieList( TRIE *root, char *dic[]);
+////////////////////////////////////////////////////////////////////////////////
+// prefix enumeration of each index for wildcardSearch
+void trie_prefix( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	triePrefixForEach( (TRIE *)index, prefix, callback, arg);
+}
 
-static int trieList_main( TRIE *root, char *dic[], int count)
+void strie_prefix( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg)
 {
-	if(root == NULL) 
-		return count;
-	if(root->index >= 0) 
-		printf("[%d]%s\n", ++count, dic[root->index]);
-	for(int i = 0; i < MAX_DEGREE; i++){
-		count = trieList_main(root->subtrees[i], dic, count);
-	}
-	return count;
+	striePrefixForEach( (STRIE *)index, prefix, callback, arg);
 }
 
-/* prints all entries starting with str (as prefix) in trie
-	ex) "ab" -> "abandoned", "abandoning", "abandonment", "abased", ...
-	this function uses trieList function
-*/
-void triePrefixList( TRIE *root, char *str, char *dic[])
+void sarray_prefix( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg)
 {
-	if(!*str)
-		trieList(root, dic);
-	if(root == NULL) 
-		return;
-	triePrefixList(root->subtrees[getIndex(*str)], str + 1, dic);
+	sarrayPrefixForEach( (SARRAY *)index, prefix, callback, arg);
 }
 
-/* makes permuterms for given str
-	ex) "abc" -> "abc$", "bc$a", "c$ab", "$abc"
-	return	number of permuterms
-*/
-int make_permuterms( char *str, char *permuterms[])
+// dictionary and # of words printed (for print_entry)
+typedef struct {
+	char	**dic;
+	int		count;
+} tPrint;
+
+void print_entry( int dic_index, void *arg)
 {
-    int len = strlen(str);
-    for (int i = 0; i <= len; i++) {
-        permuterms[i] = (char*)malloc(sizeof(char) * (len + 2));
-        if (i == 0) {
-            strcpy(permuterms[i], str);
-            permuterms[i][len] = '$';
-        } else {
-            char f = permuterms[i - 1][0];
-            strcpy(permuterms[i], permuterms[i - 1] + 1);
-            permuterms[i][len] = f;
-        }
-        permuterms[i][len + 1] = 0;
-    }
-    return len + 1;
+	tPrint *p = (tPrint *)arg;
+
+	printf( "[%d]%s\n", ++p->count, p->dic[dic_index]);
 }
 
-/* recycles memory for permuterms
-*/
-void clear_permuterms( char *permuterms[], int size)
+////////////////////////////////////////////////////////////////////////////////
+// entries of the trie collected by trieForEach (for strieBuild)
+typedef struct {
+	char	**keys;
+	int		*index;
+	int		num;
+	int		capacity;
+	int		failed; // overflow (the rest of the entries are not collected)
+} tEntries;
+
+void collect_entry( const char *key, int dic_index, void *arg)
 {
-    for (int i = 0; i < size; i++) {
-        free(permuterms[i]); // 동적으로 할당한 permuterm 메모리 해제
-    }
+	tEntries *e = (tEntries *)arg;
+	char *copy;
+
+	if (e->failed) return;
+	
+	if (e->num == e->capacity)
+	{
+		int capacity = e->capacity ? e->capacity * 2 : 1024;
+		char **keys = realloc( e->keys, sizeof( char *) * capacity);
+		if (keys != NULL) e->keys = keys;
+		int *index = realloc( e->index, sizeof( int) * capacity);
+		if (index != NULL) e->index = index;
+		
+		if (keys == NULL || index == NULL)
+		{
+			e->failed = 1;
+			return;
+		}
+		e->capacity = capacity;
+	}
+	
+	copy = strdup( key);
+	if (copy == NULL)
+	{
+		e->failed = 1;
+		return;
+	}
+	e->keys[e->num] = copy;
+	e->index[e->num++] = dic_index;
 }
 
-/* wildcard search
-	ex) "ab*", "*ab", "a*b", "*ab*"
-	this function uses triePrefixList function
+////////////////////////////////////////////////////////////////////////////////
+/* converts trie into a static trie (trie is not changed)
+	return	static trie
+			NULL if overflow
 */
-void trieSearchWildcard( TRIE *root, char *str, char *dic[])
+STRIE *freeze( TRIE *trie, int num_words, char *dic[])
 {
-    char temp[100];  // 문자열 복사본
-    strcpy(temp, str);
-    int len = strlen(temp);
-    temp[len] = '$';
-
-    for (int i = 0; i < len; i++) {
-        char c = temp[0];
-        memmove(temp, temp + 1, len + 1);
-        temp[len] = c;
-        if (c == '*') break;
-    }
-
-    temp[strchr(temp, '*') - temp] = 0;
-    triePrefixList(root, temp, dic);
+	tEntries e = { NULL, NULL, 0, 0, 0 };
+	STRIE *frozen = NULL;
+	
+	if (trieForEach( trie, collect_entry, &e) && !e.failed)
+		frozen = strieBuild( e.num, e.keys, e.index, num_words, dic);
+	
+	for (int i = 0; i < e.num; i++)
+		free( e.keys[i]);
+	free( e.keys);
+	free( e.index);
+	
+	return frozen;
 }
 
-
 ////////////////////////////////////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
-	TRIE *permute_trie;
-	char *dic[100000];
+	TRIE *permute_trie = NULL;
+	STRIE *frozen = NULL; // static trie (-s, -l)
+	SARRAY *sa = NULL; // suffix array (-a)
+	DICT *dict = NULL; // words of FILE
+	char **words = NULL; // dictionary used for queries
 
 	int ret;
-	char str[100];
+	char *str = NULL; // query (grown by readToken)
+	size_t str_size = 0;
 	FILE *fp;
-	char *permuterms[100];
-	int num_p; // # of permuterms
 	int num_words = 0;
+	long num_permuterms = 0;
+	clock_t start;
+	char *index_file = NULL;
 	
-	if (argc != 2)
+	if (argc == 3 && strcmp( argv[1], "-l") == 0)
 	{
-		fprintf( stderr, "Usage: %s FILE\n", argv[0]);
-		return 1;
+		// 저장된 정적 색인을 mmap
+		start = clock();
+		frozen = strieLoad( argv[2]);
+		if (frozen == NULL)
+		{
+			fprintf( stderr, "Index load error: %s\n", argv[2]);
+			return 1;
+		}
+		words = strieDic( frozen);
+		fprintf( stderr, "static index loaded: %.4fs, %zu bytes\n",
+			(double)(clock() - start) / CLOCKS_PER_SEC, strieMemory( frozen));
 	}
-	
-	fp = fopen( argv[1], "rt");
-	if (fp == NULL)
+	else
 	{
-		fprintf( stderr, "File open error: %s\n", argv[1]);
-		return 1;
-	}
-	
-	permute_trie = trieCreateNode(); // trie for permuterm index
-	
-	while (fscanf( fp, "%s", str) != EOF)
-	{	
-		num_p = make_permuterms( str, permuterms);
+		int use_sarray = 0;
+		int num_threads = 0; // parallel build (-j)
 		
-		for (int i = 0; i < num_p; i++)
-			trieInsert( permute_trie, permuterms[i], num_words);
+		if (argc == 4 && strcmp( argv[1], "-s") == 0)
+			index_file = argv[2];
+		else if (argc == 3 && strcmp( argv[1], "-a") == 0)
+			use_sarray = 1;
+		else if (argc == 4 && strcmp( argv[1], "-j") == 0 && atoi( argv[2]) > 0)
+			num_threads = atoi( argv[2]);
+		else if (argc != 2)
+		{
+			fprintf( stderr, "Usage: %s FILE\n", argv[0]);
+			fprintf( stderr, "       %s -s INDEX FILE (build, freeze and save static index)\n", argv[0]);
+			fprintf( stderr, "       %s -l INDEX (load static index)\n", argv[0]);
+			fprintf( stderr, "       %s -a FILE (suffix array index)\n", argv[0]);
+			fprintf( stderr, "       %s -j THREADS FILE (parallel build)\n", argv[0]);
+			return 1;
+		}
+		
+		fp = fopen( argv[argc - 1], "rt");
+		if (fp == NULL)
+		{
+			fprintf( stderr, "File open error: %s\n", argv[argc - 1]);
+			return 1;
+		}
+		
+		start = clock();
+		
+		dict = dictCreate();
+		if (dict == NULL || dictLoad( dict, fp) < 0)
+		{
+			fprintf( stderr, "Cannot read words: %s\n", argv[argc - 1]);
+			return 1;
+		}
+		fclose( fp);
 		
-		clear_permuterms( permuterms, num_p);
+		char **dic = dict->words;
+		num_words = dict->num;
+		words = dic;
 		
-		dic[num_words++] = strdup( str);
+#ifdef TRIE_ASCII_ONLY
+		// 포인터 트라이는 UTF-8 단어를 저장하지 못하므로 (조용히 빠뜨리지 않고) 거부
+		for (int i = 0; i < num_words && !use_sarray; i++)
+		{
+			for (char *p = dic[i]; *p; p++)
+			{
+				if ((unsigned char)*p >= 0x80)
+				{
+					fprintf( stderr, "Non-ASCII word [%s] in %s: use permuterm_rtrie, permuterm_atrie or -a\n",
+						dic[i], argv[argc - 1]);
+					dictDestroy( dict);
+					return 1;
+				}
+			}
+		}
+#endif
+		
+		if (!use_sarray && !num_threads)
+		{
+			permute_trie = trieCreateNode(); // trie for permuterm index
+			
+			for (int i = 0; i < num_words; i++)
+				num_permuterms += permutermInsert( permute_trie, trie_insert, dic[i], i, NULL);
+		}
+		
+		if (num_threads)
+		{
+			double t = wall_time();
+			
+			permute_trie = build_parallel( dic, num_words, num_threads, &num_permuterms);
+			if (permute_trie == NULL)
+			{
+				fprintf( stderr, "Cannot build trie\n");
+				return 1;
+			}
+			fprintf( stderr, "%d words, %ld permuterms: %.2fs (%d threads), %zu bytes\n",
+				num_words, num_permuterms, wall_time() - t, num_threads, trieMemory( permute_trie));
+		}
+		else if (use_sarray)
+		{
+			sa = sarrayBuild( num_words, dic);
+			if (sa == NULL)
+			{
+				fprintf( stderr, "Cannot build suffix array\n");
+				return 1;
+			}
+			fprintf( stderr, "%d words, %d permuterms: %.2fs, %zu bytes\n",
+				num_words, sa->numRotations, (double)(clock() - start) / CLOCKS_PER_SEC, sarrayMemory( sa));
+		}
+		else
+		{
+			// 색인 구축 시간과 메모리 (stderr)
+			fprintf( stderr, "%d words, %ld permuterms: %.2fs, %zu bytes\n",
+				num_words, num_permuterms, (double)(clock() - start) / CLOCKS_PER_SEC, trieMemory( permute_trie));
+		}
+		
+		if (index_file)
+		{
+			// 색인 구축 후에는 검색만 하므로 정적 trie로 변환
+			start = clock();
+			frozen = freeze( permute_trie, num_words, dic);
+			if (frozen == NULL || !strieSave( frozen, index_file))
+			{
+				fprintf( stderr, "Index save error: %s\n", index_file);
+				return 1;
+			}
+			fprintf( stderr, "static index: %.2fs, %zu bytes\n",
+				(double)(clock() - start) / CLOCKS_PER_SEC, strieMemory( frozen));
+			
+			trieDestroy( permute_trie);
+			permute_trie = NULL;
+		}
 	}
 	
-	fclose( fp);
-	
 	printf( "\nQuery: ");
-	while (fscanf( stdin, "%s", str) != EOF)
+	int len;
+	while ((len = readToken( stdin, &str, &str_size)) >= 0)
 	{
-		// wildcard search term
-		if (strchr( str, '*')) 
+		// wildcard search term ('*' and '?')
+		if (strpbrk( str, "*?")) 
 		{
-			trieSearchWildcard( permute_trie, str, dic);
+			tPrint p = { words, 0 };
+			
+			if (frozen) wildcardSearch( frozen, strie_prefix, str, frozen->numWords, words, print_entry, &p);
+			else if (sa) wildcardSearch( sa, sarray_prefix, str, num_words, words, print_entry, &p);
+			else wildcardSearch( permute_trie, trie_prefix, str, num_words, words, print_entry, &p);
 		}
 		// keyword search
 		else 
 		{
-			ret = trieSearch( permute_trie, str);
+			if (frozen) ret = strieSearch( frozen, str);
+			else if (sa) ret = sarraySearch( sa, str);
+			else ret = trieSearch( permute_trie, str);
 			
 			if (ret == -1) printf( "[%s] not found!\n", str);
-			else printf( "[%s] found!\n", dic[ret]);
+			else printf( "[%s] found!\n", words[ret]);
 		}
 		printf( "\nQuery: ");
 	}
+	if (len == -2) fprintf( stderr, "Cannot read query\n");
 
-	for (int i = 0; i < num_words; i++)
-		free( dic[i]);
-	
+	free( str);
+	dictDestroy( dict);
 	trieDestroy( permute_trie);
+	strieDestroy( frozen);
+	sarrayDestroy( sa);
 	
-	return 0;
+	return len == -2 ? 100 : 0;
 }
-
-
-////////////////////////////////////////////////////////////////////////////////
-void trieList( TRIE *root, char *dic[])
-{
-	if (root == NULL) return;
-
-	trieList_main(root, dic, 0);
-}
-
@@ -0,0 +1,413 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, realloc
+#include <string.h>	// strlen, memcpy, memmove
+#include <ctype.h>	// tolower
+
+#include "rtrie.h"
+
+#define KEY_BUF		256 // keys shorter than this are copied on the stack
+
+// order of subtrees: by byte, EOW last (same as the pointer trie for 'a' ~ 'z')
+#define order(x)		(((x) == EOW) ? 256 : (unsigned char)(x))
+
+// 문자: 공백, 제어 문자, 와일드카드('*', '?')와 0xff를 제외한 모든 바이트 (UTF-8 문자는 바이트 단위로 저장)
+#define isValid(x)		((unsigned char)(x) > ' ' && (unsigned char)(x) != 0x7f && (unsigned char)(x) != 0xff \
+							&& (x) != '*' && (x) != '?')
+
+/* Allocates a node with a copy of label[0..len-1]
+	used in trieCreateNode, trieInsert
+*/
+static TRIE *_createNode( const char *label, int len, int dic_index)
+{
+	TRIE *newnode = (TRIE*)malloc(sizeof(TRIE) + len + 1);
+	if (!newnode) return NULL;
+
+	newnode->index = dic_index;
+	newnode->num = 0;
+	newnode->subtrees = NULL;
+	memcpy(newnode->label, label, len);
+	newnode->label[len] = 0;
+
+	return newnode;
+}
+
+/* Finds the subtree whose label starts with c
+	return	position of the subtree in root->subtrees
+			if not found, -(insert position)-1
+	used in trieInsert, trieSearch, _locate
+*/
+static int _findChild( TRIE *root, int c)
+{
+	int i;
+
+	for (i = 0; i < root->num; i++) {
+		int first = root->subtrees[i]->label[0];
+		if (first == c) return i;
+		if (order(first) > order(c)) break;
+	}
+	return -i - 1;
+}
+
+/* Inserts child at pos in root->subtrees
+	return	1 success
+			0 overflow
+	used in trieInsert
+*/
+static int _addChild( TRIE *root, int pos, TRIE *child)
+{
+	TRIE **newSubtrees = (TRIE **)realloc(root->subtrees, sizeof(TRIE *) * (root->num + 1));
+	if (!newSubtrees) return 0;
+
+	memmove(newSubtrees + pos + 1, newSubtrees + pos, sizeof(TRIE *) * (root->num - pos));
+	newSubtrees[pos] = child;
+	root->subtrees = newSubtrees;
+	root->num++;
+
+	return 1;
+}
+
+/* Finds the node where str ends (str may end in the middle of the node's label)
+	return	node pointer
+			NULL if no entry starts with str
+	used in triePrefixList, triePrefixForEach
+*/
+static TRIE *_locate( TRIE *root, const char *str)
+{
+	while (*str) {
+		int pos = _findChild(root, *str);
+		if (pos < 0) return NULL;
+
+		TRIE *child = root->subtrees[pos];
+		int m = 0;
+		while (child->label[m] && child->label[m] == str[m]) m++;
+
+		if (str[m] == 0) return child;
+		if (child->label[m] != 0) return NULL;
+
+		root = child;
+		str += m;
+	}
+	return root;
+}
+
+TRIE *trieCreateNode(void)
+{
+	return _createNode("", 0, -1);
+}
+
+void trieDestroy( TRIE *root)
+{
+	if (!root) return;
+
+	for (int i = 0; i < root->num; i++)
+		trieDestroy(root->subtrees[i]);
+
+	free(root->subtrees);
+	free(root);
+}
+
+int trieInsert( TRIE *root, char *str, int dic_index)
+{
+	char buf[KEY_BUF];
+	int len = strlen(str);
+	char *key = (len < KEY_BUF) ? buf : (char *)malloc(len + 1);
+	int ret = 0;
+
+	if (!key) return 0;
+
+	for (int i = 0; i <= len; i++) {
+		key[i] = tolower((unsigned char)str[i]);
+		if (i < len && !isValid(key[i])) goto end;
+	}
+
+	char *s = key;
+	while (1) {
+		if (!*s) {
+			if (root->index < 0) {
+				root->index = dic_index;
+				ret = 1;
+			}
+			break; // 중복이면 0
+		}
+
+		int pos = _findChild(root, *s);
+		if (pos < 0) {
+			// new leaf with the rest of the key
+			TRIE *leaf = _createNode(s, strlen(s), dic_index);
+			if (leaf && _addChild(root, -pos - 1, leaf)) ret = 1;
+			else free(leaf);
+			break;
+		}
+
+		TRIE *child = root->subtrees[pos];
+		int m = 0;
+		while (child->label[m] && child->label[m] == s[m]) m++;
+
+		if (child->label[m] != 0) {
+			// split the label of child at m: root -> mid (label[0..m-1]) -> child (label[m..])
+			TRIE *mid = _createNode(child->label, m, -1);
+			if (!mid || !_addChild(mid, 0, child)) {
+				free(mid);
+				break;
+			}
+			int rest = strlen(child->label + m);
+			memmove(child->label, child->label + m, rest + 1);
+
+			TRIE *shrunk = (TRIE *)realloc(child, sizeof(TRIE) + rest + 1);
+			if (shrunk) mid->subtrees[0] = shrunk;
+
+			root->subtrees[pos] = mid;
+			child = mid;
+		}
+
+		root = child;
+		s += m;
+	}
+
+end:
+	if (key != buf) free(key);
+	return ret;
+}
+
+int trieSearch( TRIE *root, char *str)
+{
+	char buf[KEY_BUF];
+	int len = strlen(str);
+	char *key = (len + 1 < KEY_BUF) ? buf : (char *)malloc(len + 2);
+	int ret = -1;
+
+	if (!key) return -1;
+
+	// str + EOW (lowercase, as inserted)
+	for (int i = 0; i < len; i++)
+		key[i] = tolower((unsigned char)str[i]);
+	key[len] = EOW;
+	key[len + 1] = 0;
+
+	char *s = key;
+	while (1) {
+		if (!*s) {
+			ret = root->index;
+			break;
+		}
+
+		int pos = _findChild(root, *s);
+		if (pos < 0) break;
+
+		TRIE *child = root->subtrees[pos];
+		int m = 0;
+		while (child->label[m] && child->label[m] == s[m]) m++;
+		if (child->label[m] != 0) break;
+
+		root = child;
+		s += m;
+	}
+
+	if (key != buf) free(key);
+	return ret;
+}
+
+// used in trieList
+static int trieList_main( TRIE *root, char *dic[], int count)
+{
+	if (root->index >= 0)
+		printf("[%d]%s\n", ++count, dic[root->index]);
+	for (int i = 0; i < root->num; i++)
+		count = trieList_main(root->subtrees[i], dic, count);
+
+	return count;
+}
+
+void trieList( TRIE *root, char *dic[])
+{
+	if (root == NULL) return;
+
+	trieList_main(root, dic, 0);
+}
+
+void triePrefixList( TRIE *root, char *str, char *dic[])
+{
+	trieList(_locate(root, str), dic);
+}
+
+// used in triePrefixForEach
+static void _prefixForEach( TRIE *root, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	if (root->index >= 0)
+		callback(root->index, arg);
+	for (int i = 0; i < root->num; i++)
+		_prefixForEach(root->subtrees[i], callback, arg);
+}
+
+void triePrefixForEach( TRIE *root, char *str, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	TRIE *node = _locate(root, str);
+
+	if (node) _prefixForEach(node, callback, arg);
+}
+
+// growable key buffer for trieForEach
+typedef struct {
+	char	*buf;
+	int		size;
+	void	(*callback)(const char *key, int dic_index, void *arg);
+	void	*arg;
+} tKeyBuf;
+
+/* return	1 if every entry of root is visited
+			0 if the key buffer cannot grow (the walk stops there)
+	used in trieForEach
+*/
+static int _forEach( TRIE *root, tKeyBuf *key, int len)
+{
+	int labelLen = strlen(root->label);
+
+	while (len + labelLen + 1 > key->size) {
+		char *newbuf = (char *)realloc(key->buf, key->size * 2);
+		if (!newbuf) return 0;
+		key->buf = newbuf;
+		key->size *= 2;
+	}
+	memcpy(key->buf + len, root->label, labelLen + 1);
+	len += labelLen;
+
+	if (root->index >= 0)
+		key->callback(key->buf, root->index, key->arg);
+
+	for (int i = 0; i < root->num; i++)
+		if (!_forEach(root->subtrees[i], key, len)) return 0;
+	return 1;
+}
+
+int trieForEach( TRIE *root, void (*callback)(const char *key, int dic_index, void *arg), void *arg)
+{
+	tKeyBuf key = { (char *)malloc(64), 64, callback, arg };
+	if (!key.buf) return 0;
+
+	int ret = _forEach(root, &key, 0);
+	free(key.buf);
+	return ret;
+}
+
+/* return	1 if subtrees a and b (labels starting with the same character) have
+			no key in common and differ at the second character
+			0 otherwise
+	used in trieAttach
+*/
+static int _disjoint( TRIE *a, TRIE *b)
+{
+	if (a->label[1] && b->label[1]) return a->label[1] != b->label[1];
+	if (a->label[1]) return _findChild(b, a->label[1]) < 0;
+	if (b->label[1]) return _findChild(a, b->label[1]) < 0;
+
+	if (a->index >= 0 && b->index >= 0) return 0;
+	for (int i = 0; i < b->num; i++)
+		if (_findChild(a, b->subtrees[i]->label[0]) >= 0) return 0;
+
+	return 1;
+}
+
+// number of subtrees a brings under its first character (itself if its label is longer)
+#define numUnder(a)		((a)->label[1] ? 1 : (a)->num)
+
+/* Moves a under node, whose label is the first character of a:
+	a node of one character is replaced by node (its subtrees and entry are moved and it is freed),
+	a longer label loses its first character
+	used in trieAttach
+*/
+static void _moveUnder( TRIE *node, TRIE *a)
+{
+	int n = node->num;
+
+	if (a->label[1]) {
+		memmove(a->label, a->label + 1, strlen(a->label)); // with NUL
+		node->subtrees[node->num++] = a;
+	}
+	else {
+		for (int i = 0; i < a->num; i++)
+			node->subtrees[node->num++] = a->subtrees[i];
+		if (a->index >= 0) node->index = a->index;
+		free(a->subtrees);
+		free(a);
+	}
+
+	// the moved subtrees are sorted; each is put into place among the earlier ones
+	for (int j = n; j < node->num; j++) {
+		TRIE *x = node->subtrees[j];
+		int i = j;
+		for (; i > 0 && order(node->subtrees[i - 1]->label[0]) > order(x->label[0]); i--)
+			node->subtrees[i] = node->subtrees[i - 1];
+		node->subtrees[i] = x;
+	}
+}
+
+int trieAttach( TRIE *root, TRIE *sub)
+{
+	TRIE **merged;
+	TRIE *common[257]; // new nodes for the first characters in common
+	int i = 0, j = 0, n = 0, k = 0;
+
+	if (root->index >= 0 && sub->index >= 0) return 0;
+
+	merged = (TRIE **)malloc(sizeof(TRIE *) * (root->num + sub->num + 1));
+	if (!merged) return 0;
+
+	// checks the first characters in common and allocates their nodes before anything is moved
+	while (i < root->num && j < sub->num) {
+		TRIE *a = root->subtrees[i];
+		TRIE *b = sub->subtrees[j];
+
+		if (order(a->label[0]) < order(b->label[0])) i++;
+		else if (order(a->label[0]) > order(b->label[0])) j++;
+		else {
+			TRIE *node = _disjoint(a, b) ? _createNode(a->label, 1, -1) : NULL;
+			if (node) node->subtrees = (TRIE **)malloc(sizeof(TRIE *) * (numUnder(a) + numUnder(b)));
+			if (!node || !node->subtrees) {
+				free(node);
+				while (k > 0) {
+					k--;
+					free(common[k]->subtrees);
+					free(common[k]);
+				}
+				free(merged);
+				return 0;
+			}
+			common[k++] = node;
+			i++;
+			j++;
+		}
+	}
+
+	// merges the two sorted arrays of subtrees
+	i = j = k = 0;
+	while (i < root->num || j < sub->num) {
+		int a = (i < root->num) ? order(root->subtrees[i]->label[0]) : 257;
+		int b = (j < sub->num) ? order(sub->subtrees[j]->label[0]) : 257;
+
+		if (a == b) {
+			_moveUnder(common[k], root->subtrees[i++]);
+			_moveUnder(common[k], sub->subtrees[j++]);
+			merged[n++] = common[k++];
+		}
+		else merged[n++] = (a < b) ? root->subtrees[i++] : sub->subtrees[j++];
+	}
+
+	free(root->subtrees);
+	root->subtrees = merged;
+	root->num = n;
+	if (sub->index >= 0) root->index = sub->index;
+
+	free(sub->subtrees);
+	free(sub);
+	return 1;
+}
+
+size_t trieMemory( TRIE *root)
+{
+	size_t size = sizeof(TRIE) + strlen(root->label) + 1 + sizeof(TRIE *) * root->num;
+
+	for (int i = 0; i < root->num; i++)
+		size += trieMemory(root->subtrees[i]);
+
+	return size;
+}
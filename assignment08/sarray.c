@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, qsort
+#include <string.h>	// strlen, strchr, memcmp
+#include <ctype.h>	// tolower
+
+#include "sarray.h"
+
+#define EOW			'$' // end of word
+#define KEY_BUF		256 // keys shorter than this are copied on the stack
+
+// order of characters: by byte, EOW last (same as the tries)
+#define order(x)		(((x) == EOW) ? 256 : (unsigned char)(x))
+
+// 문자: 공백, 제어 문자, EOW, 와일드카드('*', '?')와 0xff를 제외한 모든 바이트
+#define isValid(x)		((unsigned char)(x) > ' ' && (unsigned char)(x) != 0x7f && (unsigned char)(x) != 0xff \
+							&& (x) != EOW && (x) != '*' && (x) != '?')
+
+// UTF-8 continuation byte (a rotation never starts in the middle of a character)
+#define isContinuation(x)	(((unsigned char)(x) & 0xc0) == 0x80)
+
+// text of the suffix array being sorted (qsort has no argument for it)
+static const char *sortText;
+
+/* return	length of the rotation at pos (length of its word + 1)
+	used in _compareRotations, _compareKey
+*/
+static int _length( const char *text, unsigned int pos)
+{
+	unsigned int start = pos;
+
+	while (text[start - 1]) start--; // a word starts after 0
+
+	return strchr(text + start, EOW) - (text + start) + 1;
+}
+
+/* compares two rotations (equal rotations by position)
+	used in sarrayBuild (qsort)
+*/
+static int _compareRotations( const void *p1, const void *p2)
+{
+	unsigned int pos1 = *(const unsigned int *)p1;
+	unsigned int pos2 = *(const unsigned int *)p2;
+	int len1 = _length(sortText, pos1);
+	int len2 = _length(sortText, pos2);
+	const char *r1 = sortText + pos1;
+	const char *r2 = sortText + pos2;
+
+	for (int i = 0; i < len1 && i < len2; i++)
+		if (r1[i] != r2[i]) return order(r1[i]) - order(r2[i]);
+
+	if (len1 != len2) return len1 - len2;
+	return (pos1 > pos2) - (pos1 < pos2);
+}
+
+/* compares rotation at pos with key[0 .. keyLen-1]
+	if prefix is 1, a rotation which starts with key is equal to key
+	used in _lowerBound
+*/
+static int _compareKey( const char *text, unsigned int pos, const char *key, int keyLen, int prefix)
+{
+	int len = _length(text, pos);
+	const char *r = text + pos;
+
+	for (int i = 0; i < len && i < keyLen; i++)
+		if (r[i] != key[i]) return order(r[i]) - order(key[i]);
+
+	if (prefix && keyLen <= len) return 0;
+	return len - keyLen;
+}
+
+/* return	first position in rotations whose rotation is not less than key (bound 0)
+			or greater than key (bound 1)
+	used in sarraySearch, sarrayPrefixList, sarrayPrefixForEach, sarrayPrefixPage
+*/
+static int _lowerBound( SARRAY *sa, const char *key, int keyLen, int prefix, int bound)
+{
+	int lo = 0, hi = sa->numRotations;
+
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (_compareKey(sa->text, sa->rotations[mid], key, keyLen, prefix) < bound) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+/* return	index of the word which contains pos
+	used in sarraySearch, sarrayPrefixList, sarrayPrefixForEach, sarrayPrefixPage
+*/
+static int _wordOf( SARRAY *sa, unsigned int pos)
+{
+	int lo = 0, hi = sa->numWords - 1;
+
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+		if (sa->wordStart[mid] <= pos) lo = mid;
+		else hi = mid - 1;
+	}
+	return lo;
+}
+
+SARRAY *sarrayBuild( int num_words, char *dic[])
+{
+	SARRAY *sa = (SARRAY *)calloc(1, sizeof(SARRAY));
+	size_t textSize = 2;
+	size_t numRotations = 0;
+
+	if (!sa) return NULL;
+
+	for (int i = 0; i < num_words; i++) {
+		size_t len = strlen(dic[i]);
+		textSize += 2 * len + 2;
+		numRotations += len + 1;
+	}
+
+	sa->numWords = num_words;
+	sa->textSize = textSize;
+	sa->text = (char *)malloc(textSize);
+	sa->wordStart = (unsigned int *)malloc(sizeof(unsigned int) * (num_words + 1));
+	sa->rotations = (unsigned int *)malloc(sizeof(unsigned int) * (numRotations + 1));
+	if (!sa->text || !sa->wordStart || !sa->rotations) {
+		sarrayDestroy(sa);
+		return NULL;
+	}
+
+	// "\0w$w" for each word
+	char *p = sa->text;
+	*p++ = 0;
+	for (int i = 0; i < num_words; i++) {
+		int len = strlen(dic[i]);
+		int valid = 1;
+
+		sa->wordStart[i] = p - sa->text;
+		for (int j = 0; j < len; j++) {
+			p[j] = p[len + 1 + j] = tolower((unsigned char)dic[i][j]);
+			if (!isValid(p[j])) valid = 0;
+		}
+		p[len] = EOW;
+
+		if (valid) {
+			for (int j = 0; j <= len; j++)
+				if (!isContinuation(p[j])) sa->rotations[sa->numRotations++] = sa->wordStart[i] + j;
+		}
+		p += 2 * len + 1;
+		*p++ = 0;
+	}
+	*p = 0;
+
+	sortText = sa->text;
+	qsort(sa->rotations, sa->numRotations, sizeof(unsigned int), _compareRotations);
+
+	// duplicate words: keep the rotations of the first one
+	int n = 0;
+	for (int i = 0; i < sa->numRotations; i++) {
+		if (n > 0) {
+			unsigned int prev = sa->rotations[n - 1], cur = sa->rotations[i];
+			int len = _length(sa->text, cur);
+			if (len == _length(sa->text, prev) && memcmp(sa->text + prev, sa->text + cur, len) == 0) continue;
+		}
+		sa->rotations[n++] = sa->rotations[i];
+	}
+	sa->numRotations = n;
+
+	return sa;
+}
+
+void sarrayDestroy( SARRAY *sa)
+{
+	if (!sa) return;
+
+	free(sa->text);
+	free(sa->wordStart);
+	free(sa->rotations);
+	free(sa);
+}
+
+int sarraySearch( SARRAY *sa, char *str)
+{
+	char buf[KEY_BUF];
+	int len = strlen(str);
+	char *key = (len + 1 < KEY_BUF) ? buf : (char *)malloc(len + 2);
+	int ret = -1;
+
+	if (!key) return -1;
+
+	// str + EOW (lowercase, as in text)
+	for (int i = 0; i < len; i++)
+		key[i] = tolower((unsigned char)str[i]);
+	key[len] = EOW;
+
+	int i = _lowerBound(sa, key, len + 1, 0, 0);
+	if (i < sa->numRotations && _compareKey(sa->text, sa->rotations[i], key, len + 1, 0) == 0)
+		ret = _wordOf(sa, sa->rotations[i]);
+
+	if (key != buf) free(key);
+	return ret;
+}
+
+void sarrayPrefixList( SARRAY *sa, char *str, char *dic[])
+{
+	int len = strlen(str);
+	int lo = _lowerBound(sa, str, len, 1, 0);
+	int hi = _lowerBound(sa, str, len, 1, 1);
+	int count = 0;
+
+	for (int i = lo; i < hi; i++)
+		printf("[%d]%s\n", ++count, dic[_wordOf(sa, sa->rotations[i])]);
+}
+
+void sarrayPrefixForEach( SARRAY *sa, char *str, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	int len = strlen(str);
+	int lo = _lowerBound(sa, str, len, 1, 0);
+	int hi = _lowerBound(sa, str, len, 1, 1);
+
+	for (int i = lo; i < hi; i++)
+		callback(_wordOf(sa, sa->rotations[i]), arg);
+}
+
+int sarrayPrefixPage( SARRAY *sa, char *str, int *cursor, int limit, int result[])
+{
+	int len = strlen(str);
+	int lo = _lowerBound(sa, str, len, 1, 0);
+	int hi = _lowerBound(sa, str, len, 1, 1);
+	int num = 0;
+
+	if (*cursor < 0) return 0;
+
+	for (int i = lo + *cursor; i < hi && num < limit; i++)
+		result[num++] = _wordOf(sa, sa->rotations[i]);
+
+	*cursor += num;
+	if (lo + *cursor >= hi) *cursor = -1;
+
+	return num;
+}
+
+size_t sarrayMemory( SARRAY *sa)
+{
+	return sa->textSize + sizeof(unsigned int) * (sa->numWords + sa->numRotations);
+}
@@ -0,0 +1,52 @@
+#include <stddef.h> // size_t
+
+// permuterm index as a suffix array
+// every word w is stored once as w$w in a text; the rotations of w$ are the len+1 substrings of w$w
+// starting at offsets 0 .. len (only at character boundaries for UTF-8 words), so the index is just
+// the sorted array of their start positions (4 bytes per permuterm, no nodes) and a query is a binary
+// search for a range of rotations
+
+// SARRAY type definition
+typedef struct {
+	char			*text; // "\0w$w" for each word (the 0 marks the start of a word), lowercase
+	size_t			textSize;
+	unsigned int	*wordStart; // position of each word in text
+	unsigned int	*rotations; // start positions of rotations, sorted in trie order
+	int				numWords;
+	int				numRotations;
+} SARRAY;
+
+/* Builds suffix array of permuterms for dic[0 .. num_words-1]
+	words with blanks, control characters, EOW or wildcards are not indexed (like trieInsert)
+	return	suffix array
+			NULL if overflow
+*/
+SARRAY *sarrayBuild( int num_words, char *dic[]);
+
+/* Recycles memory for suffix array
+*/
+void sarrayDestroy( SARRAY *sa);
+
+/* Retrieve suffix array for the requested key (str + EOW, case-insensitive)
+	return	index in dictionary if key found
+			-1 key not found
+*/
+int sarraySearch( SARRAY *sa, char *str);
+
+/* prints all permuterms starting with str (as prefix) (the same output as triePrefixList)
+*/
+void sarrayPrefixList( SARRAY *sa, char *str, char *dic[]);
+
+/* calls callback for every permuterm starting with str (as prefix) in the order of sarrayPrefixList
+*/
+void sarrayPrefixForEach( SARRAY *sa, char *str, void (*callback)(int dic_index, void *arg), void *arg);
+
+/* Copies up to limit indexes of permuterms starting with str (in the order of sarrayPrefixList) to result,
+	from the *cursor-th one (0 for the first page); *cursor is set to the next page, or -1 after the last one
+	return	number of indexes copied
+*/
+int sarrayPrefixPage( SARRAY *sa, char *str, int *cursor, int limit, int result[]);
+
+/* return	number of bytes used by text and arrays
+*/
+size_t sarrayMemory( SARRAY *sa);
@@ -0,0 +1,715 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, realloc, calloc
+#include <string.h>	// strlen, memcpy, memcmp
+#include <ctype.h>	// tolower
+#include <fcntl.h>	// open
+#include <unistd.h>	// close
+#include <sys/mman.h>	// mmap
+#include <sys/stat.h>	// fstat
+
+#include "strie.h"
+
+#define EOW			'$' // end of word
+#define BLOCK		512 // bits per rank block
+#define SAMPLE		512 // 0s per select sample
+#define MAGIC		"STRIE03"
+
+// file header (the image starts with it)
+typedef struct {
+	char			magic[8];
+	unsigned int	numNodes;
+	unsigned int	numKeys;
+	unsigned int	numWords;
+	unsigned int	dicBytes;
+} tHeader;
+
+// order of labels: by byte, EOW last (same as the tries)
+#define labelOrder(x)	(((x) == EOW) ? 256 : (unsigned char)(x))
+
+#define align8(x)		(((x) + 7) & ~(size_t)7)
+
+////////////////////////////////////////////////////////////////////////////////
+// bit vector
+
+/* return	# of 1s in bits[0 .. pos-1]
+	used in _value
+*/
+static int _rank( const unsigned long long *bits, const unsigned int *rank, int pos)
+{
+	int r = rank[pos / BLOCK];
+
+	for (int w = pos / BLOCK * (BLOCK / 64); w < pos / 64; w++)
+		r += __builtin_popcountll(bits[w]);
+	if (pos % 64)
+		r += __builtin_popcountll(bits[pos / 64] & ((1ULL << (pos % 64)) - 1));
+
+	return r;
+}
+
+// # of bits equal to bit before block b
+#define blockCount(rank, b, bit)	((bit) ? (int)(rank)[b] : (b) * BLOCK - (int)(rank)[b])
+
+/* return	position of the k-th bit (0 or 1; k = 0, 1, ...) in bits
+	used in _children, _parent
+*/
+static int _select( const unsigned long long *bits, const unsigned int *rank, const unsigned int *sample, int k, int bit)
+{
+	// last block which has at most k bits before it (between the blocks of the two samples around k)
+	int lo = sample[k / SAMPLE], hi = sample[k / SAMPLE + 1];
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+		if (blockCount(rank, mid, bit) <= k) lo = mid;
+		else hi = mid - 1;
+	}
+
+	int found = blockCount(rank, lo, bit);
+	int w = lo * (BLOCK / 64);
+	while (1) {
+		int ones = __builtin_popcountll(bits[w]);
+		int z = bit ? ones : 64 - ones; // bits after the end are 0 (k is always found before them)
+		if (found + z > k) break;
+		found += z;
+		w++;
+	}
+
+	// (k - found)-th bit in word w
+	unsigned long long x = bit ? bits[w] : ~bits[w];
+	for (int i = found; i < k; i++) x &= x - 1;
+
+	return w * 64 + __builtin_ctzll(x);
+}
+
+/* return	position of the first 0 from pos
+	used in _children
+*/
+static int _next0( const unsigned long long *bits, int pos)
+{
+	unsigned long long x = ~bits[pos / 64] >> (pos % 64);
+	if (x) return pos + __builtin_ctzll(x);
+
+	for (int w = pos / 64 + 1; ; w++)
+		if (~bits[w]) return w * 64 + __builtin_ctzll(~bits[w]);
+}
+
+/* Fills select samples: block of every SAMPLE-th bit (0 or 1) (the last entry is the last block)
+	used in strieBuild
+*/
+static void _buildSample( const unsigned int *rank, unsigned int *sample, int numBits, int num, int bit)
+{
+	int numBlocks = (numBits - 1) / BLOCK + 1;
+	int b = 0;
+
+	for (int j = 0; j * SAMPLE < num; j++) {
+		while (b + 1 < numBlocks && blockCount(rank, b + 1, bit) <= j * SAMPLE) b++;
+		sample[j] = b;
+	}
+	sample[(num - 1) / SAMPLE + 1] = numBlocks - 1;
+}
+
+/* Fills rank directory: # of 1s before each block
+	used in strieBuild
+*/
+static void _buildRank( const unsigned long long *bits, unsigned int *rank, int numBits)
+{
+	int r = 0;
+
+	for (int b = 0; b <= numBits / BLOCK; b++) {
+		rank[b] = r;
+		for (int w = b * (BLOCK / 64); w < (b + 1) * (BLOCK / 64) && w * 64 < numBits; w++)
+			r += __builtin_popcountll(bits[w]);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// image layout
+
+/* Sets pointers of trie to the sections of the image at base (if base is not NULL)
+	return	size of image
+	used in strieBuild, strieLoad
+*/
+static size_t _layout( STRIE *trie, char *base, unsigned int dicBytes)
+{
+	int loudsBits = 2 * trie->numNodes - 1;
+	size_t off = align8(sizeof(tHeader));
+
+#define SECTION(field, bytes)	do { if (base) trie->field = (void *)(base + off); off += align8(bytes); } while (0)
+
+	SECTION(louds, ((size_t)loudsBits / 64 + 1) * 8);
+	SECTION(loudsRank, ((size_t)loudsBits / BLOCK + 1) * 4);
+	SECTION(loudsSample, ((size_t)trie->numNodes / SAMPLE + 2) * 4);
+	SECTION(loudsSample1, ((size_t)trie->numNodes / SAMPLE + 2) * 4);
+	SECTION(term, ((size_t)trie->numNodes / 64 + 1) * 8);
+	SECTION(termRank, ((size_t)trie->numNodes / BLOCK + 1) * 4);
+	SECTION(values, (size_t)trie->numKeys * 4);
+	SECTION(labels, (size_t)trie->numNodes);
+	SECTION(dicOffset, ((size_t)trie->numWords + 1) * 4);
+	SECTION(dicBlob, (size_t)dicBytes);
+
+#undef SECTION
+
+	trie->base = base;
+	return off;
+}
+
+/* Makes dictionary pointers into dicBlob
+	return	1 success
+			0 overflow
+	used in strieBuild, strieLoad
+*/
+static int _makeDic( STRIE *trie)
+{
+	trie->dic = (char **)malloc(sizeof(char *) * (trie->numWords + 1));
+	if (!trie->dic) return 0;
+
+	for (int i = 0; i < trie->numWords; i++)
+		trie->dic[i] = (char *)trie->dicBlob + trie->dicOffset[i];
+
+	return 1;
+}
+
+/* Checks the dictionary and values of a loaded image: offsets increase within dicBlob,
+	every word ends with 0 before the next one, and values are indices of words
+	return	1 valid
+			0 corrupted
+	used in strieLoad
+*/
+static int _validate( STRIE *trie, unsigned int dicBytes)
+{
+	if (trie->dicOffset[0] != 0 || trie->dicOffset[trie->numWords] != dicBytes) return 0;
+
+	for (int i = 0; i < trie->numWords; i++) {
+		unsigned int end = trie->dicOffset[i + 1];
+		if (end <= trie->dicOffset[i] || end > dicBytes || trie->dicBlob[end - 1] != 0) return 0;
+	}
+
+	for (int k = 0; k < trie->numKeys; k++)
+		if (trie->values[k] < 0 || trie->values[k] >= trie->numWords) return 0;
+
+	return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// node of the trie during construction: keys[lo .. hi-1] share the first depth characters
+typedef struct {
+	int		lo, hi;
+	int		depth;
+	int		num; // # of subtrees
+	char	label;
+} tRange;
+
+STRIE *strieBuild( int n, char *keys[], int index[], int num_words, char *dic[])
+{
+	tRange *nodes;
+	int numNodes = 1, capacity = 1024, numKeys = 0;
+	unsigned int dicBytes = 0;
+
+	// nodes in BFS order (the queue of the search is the node list itself)
+	nodes = (tRange *)malloc(sizeof(tRange) * capacity);
+	if (!nodes) return NULL;
+	nodes[0] = (tRange){ 0, n, 0, 0, 0 };
+
+	for (int v = 0; v < numNodes; v++) {
+		int lo = nodes[v].lo, hi = nodes[v].hi, depth = nodes[v].depth;
+
+		if (lo < hi && keys[lo][depth] == 0) {
+			numKeys++;
+			lo++; // entry (the shortest key comes first)
+		}
+		while (lo < hi) {
+			char c = keys[lo][depth];
+			int end = lo + 1;
+			while (end < hi && keys[end][depth] == c) end++;
+
+			if (numNodes == capacity) {
+				tRange *newNodes = (tRange *)realloc(nodes, sizeof(tRange) * capacity * 2);
+				if (!newNodes) {
+					free(nodes);
+					return NULL;
+				}
+				nodes = newNodes;
+				capacity *= 2;
+			}
+			nodes[numNodes++] = (tRange){ lo, end, depth + 1, 0, c };
+			nodes[v].num++;
+			lo = end;
+		}
+	}
+
+	for (int i = 0; i < num_words; i++)
+		dicBytes += strlen(dic[i]) + 1;
+
+	STRIE *trie = (STRIE *)calloc(1, sizeof(STRIE));
+	if (!trie) {
+		free(nodes);
+		return NULL;
+	}
+	trie->numNodes = numNodes;
+	trie->numKeys = numKeys;
+	trie->numWords = num_words;
+
+	trie->size = _layout(trie, NULL, dicBytes);
+	char *base = (char *)calloc(1, trie->size);
+	if (!base) {
+		free(trie);
+		free(nodes);
+		return NULL;
+	}
+	_layout(trie, base, dicBytes);
+
+	tHeader *header = (tHeader *)base;
+	memcpy(header->magic, MAGIC, 8);
+	header->numNodes = numNodes;
+	header->numKeys = numKeys;
+	header->numWords = num_words;
+	header->dicBytes = dicBytes;
+
+	unsigned long long *louds = (unsigned long long *)trie->louds;
+	unsigned long long *term = (unsigned long long *)trie->term;
+	int *values = (int *)trie->values;
+	char *labels = (char *)trie->labels;
+	int pos = 0, key = 0;
+
+	for (int v = 0; v < numNodes; v++) {
+		labels[v] = nodes[v].label;
+
+		int lo = nodes[v].lo;
+		if (lo < nodes[v].hi && keys[lo][nodes[v].depth] == 0) {
+			term[v / 64] |= 1ULL << (v % 64);
+			values[key++] = index[lo];
+		}
+
+		// 1^num 0
+		for (int i = 0; i < nodes[v].num; i++, pos++)
+			louds[pos / 64] |= 1ULL << (pos % 64);
+		pos++;
+	}
+	free(nodes);
+
+	_buildRank(trie->louds, (unsigned int *)trie->loudsRank, 2 * numNodes - 1);
+	_buildRank(trie->term, (unsigned int *)trie->termRank, numNodes);
+	_buildSample(trie->loudsRank, (unsigned int *)trie->loudsSample, 2 * numNodes - 1, numNodes, 0);
+	_buildSample(trie->loudsRank, (unsigned int *)trie->loudsSample1, 2 * numNodes - 1, numNodes - 1, 1);
+
+	unsigned int *dicOffset = (unsigned int *)trie->dicOffset;
+	char *blob = (char *)trie->dicBlob;
+	dicBytes = 0;
+	for (int i = 0; i < num_words; i++) {
+		int len = strlen(dic[i]);
+		dicOffset[i] = dicBytes;
+		memcpy(blob + dicBytes, dic[i], len + 1);
+		dicBytes += len + 1;
+	}
+	dicOffset[num_words] = dicBytes;
+
+	if (!_makeDic(trie)) {
+		free(base);
+		free(trie);
+		return NULL;
+	}
+
+	return trie;
+}
+
+int strieSave( STRIE *trie, const char *filename)
+{
+	FILE *fp = fopen(filename, "wb");
+	if (!fp) return 0;
+
+	size_t written = fwrite(trie->base, 1, trie->size, fp);
+
+	if (fclose(fp) != 0 || written != trie->size) return 0;
+	return 1;
+}
+
+STRIE *strieLoad( const char *filename)
+{
+	struct stat st;
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) return NULL;
+
+	if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(tHeader)) {
+		close(fd);
+		return NULL;
+	}
+
+	char *base = (char *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) return NULL;
+
+	tHeader *header = (tHeader *)base;
+	STRIE *trie = (STRIE *)calloc(1, sizeof(STRIE));
+	if (!trie || memcmp(header->magic, MAGIC, 8) != 0
+		|| header->numNodes == 0 || header->numNodes > INT_MAX / 2
+		|| header->numKeys > header->numNodes || header->numWords > INT_MAX / 2) {
+		free(trie);
+		munmap(base, st.st_size);
+		return NULL;
+	}
+
+	trie->numNodes = header->numNodes;
+	trie->numKeys = header->numKeys;
+	trie->numWords = header->numWords;
+	trie->size = _layout(trie, base, header->dicBytes);
+	trie->mapped = 1;
+
+	if (trie->size != (size_t)st.st_size || !_validate(trie, header->dicBytes) || !_makeDic(trie)) {
+		munmap(base, st.st_size);
+		free(trie);
+		return NULL;
+	}
+
+	return trie;
+}
+
+void strieDestroy( STRIE *trie)
+{
+	if (!trie) return;
+
+	if (trie->mapped) munmap(trie->base, trie->size);
+	else free(trie->base);
+
+	free(trie->dic);
+	free(trie->score);
+	free(trie->best);
+	free(trie);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// navigation
+
+/* Finds the first subtree of v and # of subtrees
+	used in _child, _list, _prefixForEach, _nextPreorder, strieTopK
+*/
+static void _children( STRIE *trie, int v, int *first, int *num)
+{
+	int start = (v == 0) ? 0 : _select(trie->louds, trie->loudsRank, trie->loudsSample, v - 1, 0) + 1;
+
+	*first = start - v + 1; // # of 1s before start + 1
+	*num = _next0(trie->louds, start) - start;
+}
+
+/* return	subtree of v with label c
+			-1 if not found
+	used in strieSearch, _locate
+*/
+static int _child( STRIE *trie, int v, char c)
+{
+	int first, num;
+
+	_children(trie, v, &first, &num);
+	for (int i = first; i < first + num; i++) {
+		if (trie->labels[i] == c) return i;
+		if (labelOrder(trie->labels[i]) > labelOrder(c)) break;
+	}
+	return -1;
+}
+
+/* return	node where str ends
+			-1 if not found
+	used in strieSearch, striePrefixList, striePrefixForEach, striePrefixPage, strieTopK
+*/
+static int _locate( STRIE *trie, const char *str)
+{
+	int v = 0;
+
+	for (; *str && v >= 0; str++)
+		v = _child(trie, v, *str);
+
+	return v;
+}
+
+/* return	index of entry at v
+			-1 if v is not an entry
+	used in strieSearch, _list, _prefixForEach, striePrefixPage, strieSetScores, strieTopK
+*/
+static int _value( STRIE *trie, int v)
+{
+	if (!(trie->term[v / 64] >> (v % 64) & 1)) return -1;
+
+	return trie->values[_rank(trie->term, trie->termRank, v)];
+}
+
+int strieSearch( STRIE *trie, char *str)
+{
+	int v = 0;
+
+	// keys are stored in lowercase (trieInsert)
+	for (; *str && v >= 0; str++)
+		v = _child(trie, v, tolower((unsigned char)*str));
+	if (v < 0) return -1;
+
+	v = _child(trie, v, EOW);
+	if (v < 0) return -1;
+
+	return _value(trie, v);
+}
+
+// used in striePrefixList
+static int _list( STRIE *trie, int v, char *dic[], int count)
+{
+	int index = _value(trie, v);
+	int first, num;
+
+	if (index >= 0)
+		printf("[%d]%s\n", ++count, dic[index]);
+
+	_children(trie, v, &first, &num);
+	for (int i = first; i < first + num; i++)
+		count = _list(trie, i, dic, count);
+
+	return count;
+}
+
+void striePrefixList( STRIE *trie, char *str, char *dic[])
+{
+	int v = _locate(trie, str);
+
+	if (v >= 0) _list(trie, v, dic, 0);
+}
+
+// used in striePrefixForEach
+static void _prefixForEach( STRIE *trie, int v, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	int index = _value(trie, v);
+	int first, num;
+
+	if (index >= 0)
+		callback(index, arg);
+
+	_children(trie, v, &first, &num);
+	for (int i = first; i < first + num; i++)
+		_prefixForEach(trie, i, callback, arg);
+}
+
+void striePrefixForEach( STRIE *trie, char *str, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	int v = _locate(trie, str);
+
+	if (v >= 0) _prefixForEach(trie, v, callback, arg);
+}
+
+/* return	parent of v (v > 0)
+	used in _nextPreorder, _inSubtree
+*/
+static int _parent( STRIE *trie, int v)
+{
+	// the 1 of v is the (v-1)-th 1, in the unary degree of the node numbered by the 0s before it
+	int pos = _select(trie->louds, trie->loudsRank, trie->loudsSample1, v - 1, 1);
+
+	return pos - (v - 1);
+}
+
+/* return	1 if v is a node in the subtree of top
+			0 otherwise
+	used in striePrefixPage
+*/
+static int _inSubtree( STRIE *trie, int v, int top)
+{
+	if (v >= trie->numNodes) return 0;
+
+	// nodes are numbered level by level, so a parent is numbered before its children
+	while (v > top)
+		v = _parent(trie, v);
+
+	return v == top;
+}
+
+/* return	node after v in preorder (the order of striePrefixList) within the subtree of top
+			-1 if v is the last one
+	used in striePrefixPage
+*/
+static int _nextPreorder( STRIE *trie, int v, int top)
+{
+	int first, num;
+
+	_children(trie, v, &first, &num);
+	if (num > 0) return first;
+
+	while (v != top) {
+		int p = _parent(trie, v);
+		_children(trie, p, &first, &num);
+		if (v + 1 < first + num) return v + 1; // next sibling
+		v = p;
+	}
+	return -1;
+}
+
+int striePrefixPage( STRIE *trie, char *str, int *cursor, int limit, int result[])
+{
+	int top = _locate(trie, str);
+	int num = 0;
+
+	// a token of another prefix (or another trie) would walk up past the root
+	if (top < 0 || *cursor < 0 || (*cursor > 0 && !_inSubtree(trie, *cursor, top))) {
+		*cursor = -1;
+		return 0;
+	}
+
+	// the first page starts at top, the others after the node of the last entry
+	int v = (*cursor == 0) ? top : _nextPreorder(trie, *cursor, top);
+	for (; v >= 0; v = _nextPreorder(trie, v, top)) {
+		int index = _value(trie, v);
+		if (index < 0) continue;
+
+		if (num == limit) break; // v is the first entry of the next page
+		result[num++] = index;
+		*cursor = v;
+	}
+	if (v < 0) *cursor = -1;
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// top-k completion
+
+int strieSetScores( STRIE *trie, const int score[])
+{
+	int *parent = (int *)malloc(sizeof(int) * trie->numNodes);
+	int *newScore = (int *)malloc(sizeof(int) * trie->numWords);
+	int *best = (int *)malloc(sizeof(int) * trie->numNodes);
+
+	if (!parent || !newScore || !best) {
+		free(parent);
+		free(newScore);
+		free(best);
+		return 0;
+	}
+	memcpy(newScore, score, sizeof(int) * trie->numWords);
+
+	// parents by a scan of LOUDS (node v is 1^(# of subtrees) 0, subtrees numbered from 1)
+	int child = 1;
+	for (int v = 0, pos = 0; v < trie->numNodes; v++, pos++)
+		for (; trie->louds[pos / 64] >> (pos % 64) & 1; pos++)
+			parent[child++] = v;
+
+	// subtrees come after their parents in BFS order
+	for (int v = 0; v < trie->numNodes; v++) {
+		int index = _value(trie, v);
+		best[v] = (index >= 0) ? newScore[index] : SCORE_NONE;
+	}
+	for (int v = trie->numNodes - 1; v > 0; v--)
+		if (best[v] > best[parent[v]]) best[parent[v]] = best[v];
+
+	free(parent);
+	free(trie->score);
+	free(trie->best);
+	trie->score = newScore;
+	trie->best = best;
+
+	return 1;
+}
+
+// item of the best-first search: an entry (its score) or a subtree (its best score)
+typedef struct {
+	int		score;
+	int		node;
+	int		entry; // 1 if item is the entry at node
+} tItem;
+
+// max heap of items (ties by node: lexically smaller subtrees first among siblings)
+#define itemLess(a, b)	((a).score < (b).score || ((a).score == (b).score && (a).node > (b).node))
+
+/* Inserts item into heap (heap grows by doubling)
+	return	1 success
+			0 overflow
+	used in strieTopK
+*/
+static int _push( tItem **heap, int *num, int *capacity, tItem item)
+{
+	if (*num == *capacity) {
+		tItem *newHeap = (tItem *)realloc(*heap, sizeof(tItem) * *capacity * 2);
+		if (!newHeap) return 0;
+		*heap = newHeap;
+		*capacity *= 2;
+	}
+
+	int i = (*num)++;
+	while (i > 0 && itemLess((*heap)[(i - 1) / 2], item)) {
+		(*heap)[i] = (*heap)[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	(*heap)[i] = item;
+
+	return 1;
+}
+
+/* Deletes the largest item from heap
+	used in strieTopK
+*/
+static tItem _pop( tItem *heap, int *num)
+{
+	tItem top = heap[0];
+	tItem last = heap[--(*num)];
+	int i = 0;
+
+	while (2 * i + 1 < *num) {
+		int c = 2 * i + 1;
+		if (c + 1 < *num && itemLess(heap[c], heap[c + 1])) c++;
+		if (!itemLess(last, heap[c])) break;
+		heap[i] = heap[c];
+		i = c;
+	}
+	heap[i] = last;
+
+	return top;
+}
+
+int strieTopK( STRIE *trie, char *str, int k, int result[])
+{
+	int v = _locate(trie, str);
+	int capacity = 64, num = 0, count = 0;
+	tItem *heap;
+
+	if (v < 0 || k <= 0 || !trie->best || trie->best[v] == SCORE_NONE) return 0;
+
+	heap = (tItem *)malloc(sizeof(tItem) * capacity);
+	if (!heap) return -1;
+	_push(&heap, &num, &capacity, (tItem){ trie->best[v], v, 0 });
+
+	// the largest item is always the best remaining entry or a subtree which contains it
+	while (num > 0 && count < k) {
+		tItem item = _pop(heap, &num);
+
+		if (item.entry) {
+			int index = _value(trie, item.node);
+			int dup = 0;
+			// a word may have several entries (rotations) under str
+			for (int i = 0; i < count && !dup; i++)
+				dup = (result[i] == index);
+			if (!dup) result[count++] = index;
+			continue;
+		}
+
+		int index = _value(trie, item.node);
+		int first, n, ok = 1;
+
+		if (index >= 0)
+			ok = _push(&heap, &num, &capacity, (tItem){ trie->score[index], item.node, 1 });
+
+		_children(trie, item.node, &first, &n);
+		for (int i = first; i < first + n && ok; i++)
+			ok = _push(&heap, &num, &capacity, (tItem){ trie->best[i], i, 0 });
+
+		if (!ok) {
+			free(heap);
+			return -1;
+		}
+	}
+
+	free(heap);
+	return count;
+}
+
+char **strieDic( STRIE *trie)
+{
+	return trie->dic;
+}
+
+size_t strieMemory( STRIE *trie)
+{
+	size_t size = trie->size + sizeof(char *) * trie->numWords;
+
+	if (trie->best) size += sizeof(int) * (trie->numNodes + trie->numWords);
+	return size;
+}
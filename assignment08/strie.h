@@ -0,0 +1,106 @@
+#include <stddef.h> // size_t
+#include <limits.h> // INT_MIN
+
+// static (read-only) succinct trie
+// a trie is frozen into LOUDS (level-order unary degree sequence) bit vectors with rank/select directories,
+// a label per node, and the dictionary; the image is position-independent and can be saved and mmap-ed as is
+//
+// LOUDS: nodes are numbered in BFS order (root 0) and node v is written as 1^(# of subtrees) 0,
+// so the subtrees of v are the nodes s(v)-v+1, ... where s(v) is the position after the (v-1)-th 0
+
+#define SCORE_NONE	INT_MIN // best score of a subtree without entries
+
+// STRIE type definition
+typedef struct {
+	void	*base; // image (malloc-ed or mmap-ed)
+	size_t	size; // size of image
+	int		mapped; // 1 if base is mmap-ed
+
+	int		numNodes;
+	int		numKeys; // # of entries
+	int		numWords; // # of words in dictionary
+
+	const unsigned long long	*louds; // 2 * numNodes - 1 bits
+	const unsigned int			*loudsRank; // # of 1s before each 512-bit block
+	const unsigned int			*loudsSample; // block of every 512th 0 (for select)
+	const unsigned int			*loudsSample1; // block of every 512th 1 (for select of parents)
+	const unsigned long long	*term; // 1 if node is an entry
+	const unsigned int			*termRank; // # of 1s before each 512-bit block
+	const int					*values; // index of each entry (in node order)
+	const char					*labels; // character on the edge into each node
+	const unsigned int			*dicOffset; // start of each word in dicBlob
+	const char					*dicBlob;
+
+	char	**dic; // pointers to words in dicBlob
+	int		*score; // score of each word (strieSetScores)
+	int		*best; // best score in the subtree of each node (strieSetScores)
+} STRIE;
+
+/* Builds static trie from n entries (keys must be sorted in trie order, as given by trieForEach)
+	and dictionary dic[0 .. num_words-1]
+	return	static trie
+			NULL if overflow
+*/
+STRIE *strieBuild( int n, char *keys[], int index[], int num_words, char *dic[]);
+
+/* Writes image of static trie to file
+	return	1 success
+			0 file error
+*/
+int strieSave( STRIE *trie, const char *filename);
+
+/* Maps image of static trie in file (nothing but the dictionary pointers is copied)
+	return	static trie
+			NULL if file error or file is not a static trie
+*/
+STRIE *strieLoad( const char *filename);
+
+/* Recycles memory (or unmaps file) of static trie
+*/
+void strieDestroy( STRIE *trie);
+
+/* Retrieve trie for the requested key (str + EOW, case-insensitive)
+	return	index in dictionary if key found
+			-1 key not found
+*/
+int strieSearch( STRIE *trie, char *str);
+
+/* prints all entries starting with str (as prefix) in trie (the same output as triePrefixList)
+*/
+void striePrefixList( STRIE *trie, char *str, char *dic[]);
+
+/* calls callback for every entry starting with str (as prefix) in the order of striePrefixList
+*/
+void striePrefixForEach( STRIE *trie, char *str, void (*callback)(int dic_index, void *arg), void *arg);
+
+/* Copies up to limit indexes of entries starting with str (in the order of striePrefixList) to result
+	*cursor is 0 for the first page; it is set to the resume token of the next page (the node of the last entry),
+	or -1 if there are no more entries
+	the trie is read-only, so a token stays valid between calls (and between processes mapping the same file),
+	but only with the same str; a token that is not a node under str ends the listing (*cursor is set to -1)
+	return	number of indexes copied
+*/
+int striePrefixPage( STRIE *trie, char *str, int *cursor, int limit, int result[]);
+
+/* Sets score of each word (ex. frequency) and caches the best score in the subtree of each node
+	score has numWords entries and is copied
+	return	1 success
+			0 overflow
+*/
+int strieSetScores( STRIE *trie, const int score[]);
+
+/* Copies indexes of the k words with the highest scores among entries starting with str to result
+	(best-first search guided by the cached subtree scores; needs strieSetScores)
+	ex) "$ab" -> the k best words starting with "ab" (permuterm index)
+	return	number of indexes copied (at most k)
+			-1 overflow
+*/
+int strieTopK( STRIE *trie, char *str, int k, int result[]);
+
+/* return	dictionary stored in static trie
+*/
+char **strieDic( STRIE *trie);
+
+/* return	number of bytes of image, dictionary pointers and scores
+*/
+size_t strieMemory( STRIE *trie);
@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdlib.h>	// malloc, realloc
+#include <ctype.h>	// tolower
+
+#include "trie.h"
+
+// used in the following functions: trieInsert, trieSearch, triePrefixList
+#define getIndex(x)		(((x) == EOW) ? MAX_DEGREE-1 : ((x) - 'a'))
+
+// 영문자 또는 EOW
+#define isValid(x)		(((x) >= 'a' && (x) <= 'z') || (x) == EOW)
+
+TRIE *trieCreateNode(void)
+{
+    TRIE *newnode = (TRIE*)malloc(sizeof(TRIE));
+    if (!newnode) return NULL;
+
+    newnode->index = -1; // 초기값 -1로 설정
+    for (int i = 0; i < MAX_DEGREE; i++) {
+        newnode->subtrees[i] = NULL; // 초기화 수정
+    }
+
+    return newnode;
+}
+
+void trieDestroy( TRIE *root)
+{
+    if (!root) return;
+
+    for (int i = 0; i < MAX_DEGREE; i++) {
+        if (root->subtrees[i]) {
+            trieDestroy(root->subtrees[i]);
+        }
+    }
+
+    free(root); // 모든 하위 노드를 해제한 후 루트 노드 해제
+}
+
+// used in trieInsert
+static int _insert( TRIE *root, char *str, int dic_index)
+{
+	if(!*str){
+		if(root->index >= 0) return 0; // 중복
+		root->index = dic_index;
+		return 1;
+	}
+	int c = tolower((unsigned char)*str);
+	TRIE** sub = &root->subtrees[getIndex(c)];
+	if(!*sub){
+		*sub = trieCreateNode();
+		if(!*sub) return 0;
+	}
+	return _insert(*sub, str+1, dic_index);
+}
+
+int trieInsert( TRIE *root, char *str, int dic_index)
+{
+	for (char *p = str; *p; p++)
+		if (!isValid(tolower((unsigned char)*p))) return 0;
+
+	return _insert(root, str, dic_index);
+}
+
+int trieSearch( TRIE *root, char *str)
+{
+	if (!root) 
+		return -1;
+
+	if(!*str){
+		if(!root->subtrees[getIndex(EOW)]) 
+			return -1;
+		else
+			return root->subtrees[getIndex(EOW)]->index;
+	}
+
+	int c = tolower((unsigned char)*str); // 삽입과 같이 대소문자 구분 없음
+	if (!isValid(c))
+		return -1;
+	else 
+		return trieSearch(root->subtrees[getIndex(c)], str+1);
+}
+
+static int trieList_main( TRIE *root, char *dic[], int count)
+{
+	if(root == NULL) 
+		return count;
+	if(root->index >= 0) 
+		printf("[%d]%s\n", ++count, dic[root->index]);
+	for(int i = 0; i < MAX_DEGREE; i++){
+		count = trieList_main(root->subtrees[i], dic, count);
+	}
+	return count;
+}
+
+void trieList( TRIE *root, char *dic[])
+{
+	if (root == NULL) return;
+
+	trieList_main(root, dic, 0);
+}
+
+void triePrefixList( TRIE *root, char *str, char *dic[])
+{
+	if(root == NULL) 
+		return;
+	if(!*str){
+		trieList(root, dic);
+		return;
+	}
+	if(!isValid(*str))
+		return;
+	triePrefixList(root->subtrees[getIndex(*str)], str + 1, dic);
+}
+
+// used in triePrefixForEach
+static void _prefixForEach( TRIE *root, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	if (root == NULL) return;
+
+	if (root->index >= 0)
+		callback(root->index, arg);
+	for (int i = 0; i < MAX_DEGREE; i++)
+		_prefixForEach(root->subtrees[i], callback, arg);
+}
+
+void triePrefixForEach( TRIE *root, char *str, void (*callback)(int dic_index, void *arg), void *arg)
+{
+	for (; root && *str; str++) {
+		if (!isValid(*str)) return;
+		root = root->subtrees[getIndex(*str)];
+	}
+	_prefixForEach(root, callback, arg);
+}
+
+// growable key buffer for trieForEach
+typedef struct {
+	char	*buf;
+	int		size;
+	void	(*callback)(const char *key, int dic_index, void *arg);
+	void	*arg;
+} tKeyBuf;
+
+/* return	1 if every entry of root is visited
+			0 if the key buffer cannot grow (the walk stops there)
+	used in trieForEach
+*/
+static int _forEach( TRIE *root, tKeyBuf *key, int len)
+{
+	if (root->index >= 0) {
+		key->buf[len] = 0;
+		key->callback(key->buf, root->index, key->arg);
+	}
+	if (len + 2 > key->size) {
+		char *newbuf = (char *)realloc(key->buf, key->size * 2);
+		if (!newbuf) return 0;
+		key->buf = newbuf;
+		key->size *= 2;
+	}
+	for (int i = 0; i < MAX_DEGREE; i++) {
+		if (root->subtrees[i]) {
+			key->buf[len] = (i == MAX_DEGREE-1) ? EOW : 'a' + i;
+			if (!_forEach(root->subtrees[i], key, len + 1)) return 0;
+		}
+	}
+	return 1;
+}
+
+int trieForEach( TRIE *root, void (*callback)(const char *key, int dic_index, void *arg), void *arg)
+{
+	tKeyBuf key = { (char *)malloc(64), 64, callback, arg };
+	if (!key.buf) return 0;
+
+	int ret = _forEach(root, &key, 0);
+	free(key.buf);
+	return ret;
+}
+
+/* return	1 if root and sub have no subtree and no entry in common
+			0 otherwise
+	used in trieAttach
+*/
+static int _disjoint( TRIE *root, TRIE *sub)
+{
+	if (root->index >= 0 && sub->index >= 0) return 0;
+	for (int i = 0; i < MAX_DEGREE; i++)
+		if (root->subtrees[i] && sub->subtrees[i]) return 0;
+
+	return 1;
+}
+
+/* Moves subtrees and entry of sub into root and frees sub (root and sub are disjoint)
+	used in trieAttach
+*/
+static void _move( TRIE *root, TRIE *sub)
+{
+	for (int i = 0; i < MAX_DEGREE; i++)
+		if (sub->subtrees[i]) root->subtrees[i] = sub->subtrees[i];
+	if (sub->index >= 0) root->index = sub->index;
+
+	free(sub);
+}
+
+int trieAttach( TRIE *root, TRIE *sub)
+{
+	if (root->index >= 0 && sub->index >= 0) return 0;
+	for (int i = 0; i < MAX_DEGREE; i++)
+		if (root->subtrees[i] && sub->subtrees[i] && !_disjoint(root->subtrees[i], sub->subtrees[i])) return 0;
+
+	for (int i = 0; i < MAX_DEGREE; i++) {
+		if (!sub->subtrees[i]) continue;
+		if (root->subtrees[i]) _move(root->subtrees[i], sub->subtrees[i]); // common first character
+		else root->subtrees[i] = sub->subtrees[i];
+	}
+	if (sub->index >= 0) root->index = sub->index;
+
+	free(sub);
+	return 1;
+}
+
+size_t trieMemory( TRIE *root)
+{
+	if (root == NULL) return 0;
+
+	size_t size = sizeof(TRIE);
+	for (int i = 0; i < MAX_DEGREE; i++)
+		size += trieMemory(root->subtrees[i]);
+
+	return size;
+}
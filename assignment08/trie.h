@@ -0,0 +1,72 @@
+#include <stddef.h> // size_t
+
+#define MAX_DEGREE	27 // 'a' ~ 'z' and EOW
+#define EOW			'$' // end of word
+
+// keys are English letters only (UTF-8 words cannot be stored; see rtrie.h, atrie.h)
+#define TRIE_ASCII_ONLY
+
+// TRIE type definition
+typedef struct trieNode {
+	int 			index; // -1 (non-word), 0, 1, 2, ...
+	struct trieNode	*subtrees[MAX_DEGREE];
+} TRIE;
+
+/* Allocates dynamic memory for a trie node and returns its address to caller
+	return	node pointer
+			NULL if overflow
+*/
+TRIE *trieCreateNode(void);
+
+/* Deletes all data in trie and recycles memory
+*/
+void trieDestroy( TRIE *root);
+
+/* Inserts new entry into the trie
+	return	1 success
+			0 failure
+*/
+// 주의! 엔트리를 중복 삽입하지 않도록 체크해야 함
+// 대소문자를 소문자로 통일하여 삽입
+// 영문자와 EOW 외 문자를 포함하는 문자열은 삽입하지 않음
+int trieInsert( TRIE *root, char *str, int dic_index);
+
+/* Retrieve trie for the requested key
+	return	index in dictionary (trie) if key found
+			-1 key not found
+*/
+// 대소문자 구분 없이 검색
+int trieSearch( TRIE *root, char *str);
+
+/* prints all entries in trie using preorder traversal
+*/
+void trieList( TRIE *root, char *dic[]);
+
+/* prints all entries starting with str (as prefix) in trie
+	ex) "ab" -> "abandoned", "abandoning", "abandonment", "abased", ...
+	this function uses trieList function
+*/
+void triePrefixList( TRIE *root, char *str, char *dic[]);
+
+/* calls callback for every entry starting with str (as prefix) in the order of triePrefixList
+*/
+void triePrefixForEach( TRIE *root, char *str, void (*callback)(int dic_index, void *arg), void *arg);
+
+/* calls callback for every entry in trie in preorder (the order of trieList) with its key and index
+	return	1 success
+			0 overflow (the key buffer cannot grow; some entries are not visited)
+*/
+int trieForEach( TRIE *root, void (*callback)(const char *key, int dic_index, void *arg), void *arg);
+
+/* Moves all entries of sub into root and frees the root node of sub
+	(for tries built in parallel over disjoint first characters,
+	or over disjoint second characters under a common first character)
+	return	1 success
+			0 root and sub have keys starting with the same two characters,
+			  or overflow (nothing is moved)
+*/
+int trieAttach( TRIE *root, TRIE *sub);
+
+/* return	number of bytes used by trie nodes (without malloc overhead)
+*/
+size_t trieMemory( TRIE *root);
@@ -0,0 +1,153 @@
+#include <stdlib.h>	// malloc, calloc
+#include <string.h>	// strlen
+#include <ctype.h>	// tolower
+
+#include "wildcard.h"
+
+#define EOW			'$' // end of word
+#define KEY_BUF		256 // keys shorter than this are built on the stack
+
+#define isWildcard(x)	((x) == '*' || (x) == '?')
+
+// UTF-8 continuation byte
+#define isContinuation(x)	(((unsigned char)(x) & 0xc0) == 0x80)
+
+// state of a query (passed to the prefix enumeration)
+typedef struct {
+	const char		*pattern;
+	char			**dic;
+	unsigned char	*seen; // bitmap of words already checked (NULL if a word cannot be enumerated twice)
+	void			(*callback)(int dic_index, void *arg);
+	void			*arg;
+	int				count;
+} tQuery;
+
+/* return	start of the character after s (UTF-8)
+	used in globMatch
+*/
+static const char *_next( const char *s)
+{
+	do s++; while (isContinuation(*s));
+
+	return s;
+}
+
+int globMatch( const char *pattern, const char *str)
+{
+	const char *star = NULL; // last '*' in pattern
+	const char *resume = NULL; // where the last '*' started matching in str
+
+	while (*str) {
+		if (*pattern == '*') {
+			star = pattern++;
+			resume = str;
+		}
+		else if (*pattern == '?') {
+			pattern++;
+			str = _next(str);
+		}
+		else if (*pattern && tolower((unsigned char)*pattern) == tolower((unsigned char)*str)) {
+			pattern++;
+			str++;
+		}
+		else if (star) {
+			// the last '*' takes one more character
+			pattern = star + 1;
+			str = resume = _next(resume);
+		}
+		else return 0;
+	}
+	while (*pattern == '*') pattern++;
+
+	return *pattern == 0;
+}
+
+/* Copies the longest piece of pattern$ without wildcards (read cyclically) to key (lowercase)
+	key must be at least strlen(pattern) + 2 bytes
+	return	1 if the piece contains EOW (a word has only one rotation starting with it)
+			0 otherwise
+	used in wildcardSearch
+*/
+static int _anchor( const char *pattern, int len, char *key)
+{
+	int first = 0; // first wildcard
+	int last = len - 1; // last wildcard
+	int n = 0;
+
+	while (first < len && !isWildcard(pattern[first])) first++;
+	while (last >= 0 && !isWildcard(pattern[last])) last--;
+
+	if (first == len) {
+		// no wildcard: pattern$
+		for (int i = 0; i < len; i++) key[n++] = tolower((unsigned char)pattern[i]);
+		key[n++] = EOW;
+		key[n] = 0;
+		return 1;
+	}
+
+	// the longest piece between wildcards
+	int start = 0, size = 0;
+	for (int i = first + 1; i < last; ) {
+		int j = i;
+		while (j < last && !isWildcard(pattern[j])) j++;
+		if (j - i > size) {
+			start = i;
+			size = j - i;
+		}
+		i = j + 1;
+	}
+
+	// the piece around EOW: (after last wildcard) $ (before first wildcard)
+	if (len - last - 1 + 1 + first >= size) {
+		for (int i = last + 1; i < len; i++) key[n++] = tolower((unsigned char)pattern[i]);
+		key[n++] = EOW;
+		for (int i = 0; i < first; i++) key[n++] = tolower((unsigned char)pattern[i]);
+		key[n] = 0;
+		return 1;
+	}
+
+	for (int i = 0; i < size; i++) key[n++] = tolower((unsigned char)pattern[start + i]);
+	key[n] = 0;
+	return 0;
+}
+
+// used in wildcardSearch (by prefix enumeration)
+static void _candidate( int dic_index, void *arg)
+{
+	tQuery *q = (tQuery *)arg;
+
+	if (q->seen) {
+		if (q->seen[dic_index / 8] >> (dic_index % 8) & 1) return;
+		q->seen[dic_index / 8] |= 1 << (dic_index % 8);
+	}
+
+	if (globMatch(q->pattern, q->dic[dic_index])) {
+		q->count++;
+		q->callback(dic_index, q->arg);
+	}
+}
+
+int wildcardSearch( void *index, tPrefixForEach prefix_for_each, char *pattern,
+	int num_words, char *dic[], void (*callback)(int dic_index, void *arg), void *arg)
+{
+	char buf[KEY_BUF];
+	int len = strlen(pattern);
+	char *key = (len + 2 <= KEY_BUF) ? buf : (char *)malloc(len + 2);
+	tQuery q = { pattern, dic, NULL, callback, arg, 0 };
+
+	if (!key) return -1;
+
+	if (!_anchor(pattern, len, key)) {
+		q.seen = (unsigned char *)calloc(num_words / 8 + 1, 1);
+		if (!q.seen) {
+			if (key != buf) free(key);
+			return -1;
+		}
+	}
+
+	prefix_for_each(index, key, _candidate, &q);
+
+	free(q.seen);
+	if (key != buf) free(key);
+	return q.count;
+}
@@ -0,0 +1,24 @@
+// wildcard query engine over a permuterm index
+// '*' matches any string (possibly empty), '?' matches exactly one character (UTF-8 aware)
+//
+// every rotation of word$ is in the index, so any piece of the query without wildcards in query$
+// (read cyclically) is a prefix of some rotation: the longest such piece is looked up by prefix
+// enumeration and the candidates are filtered by globMatch
+// ex) "a*b*c" -> "c$a", "?at" -> "at$", "*zz*" -> "zz"
+
+// prefix enumeration of an index (triePrefixForEach, striePrefixForEach, sarrayPrefixForEach)
+typedef void (*tPrefixForEach)( void *index, char *prefix, void (*callback)(int dic_index, void *arg), void *arg);
+
+/* Matches str against pattern with '*' and '?' (case-insensitive)
+	return	1 match
+			0 no match
+*/
+int globMatch( const char *pattern, const char *str);
+
+/* Calls callback for every word in dic[0 .. num_words-1] matching pattern, using index for candidates
+	the order is that of the prefix enumeration; each word is reported once
+	return	number of words matched
+			-1 overflow
+*/
+int wildcardSearch( void *index, tPrefixForEach prefix_for_each, char *pattern,
+	int num_words, char *dic[], void (*callback)(int dic_index, void *arg), void *arg);